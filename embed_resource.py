@@ -36,6 +36,7 @@ def main():
         hpp.write(f"extern const unsigned int {normalize_filename(img)}_length;\n\n")
 
     # FONTS
+    # Their prebaked glyphs in src/renderer/prebaked_fonts.cpp come from `make fonts`.
     cpp.write(create_resource_bytes("fonts/DejaVu/DejaVuSans.ttf"))
     hpp.write(f"extern const unsigned char {normalize_filename('DejaVuSans.ttf')}[];\n")
     hpp.write(f"extern const unsigned int {normalize_filename('DejaVuSans.ttf')}_length;\n\n")
@@ -50,6 +50,7 @@ int main(int argc, char **argv) {
             });
         app->append(edit, Fill::Horizontal);
         results_view = new ScrolledBox(Align::Vertical);
+        results_view->setLayered(true);
             for (auto m : monster_names) {
                 results_view->append(new Label(m));
             }
@@ -20,11 +20,10 @@ uint32_t timerCallback(uint32_t interval, void *data) {
     ProgressBar *bar = (ProgressBar*)(app->mainWidget()->children[1]->children[0]->children[3]->children[0]);
     double value = bar->m_value;
     if (value < 1.0) {
-        bar->m_value += 0.01;
+        bar->setValue(value + 0.01);
     } else {
-        bar->m_value = 0.0;
+        bar->setValue(0.0);
     }
-    app->update();
     app->pulse();
 
     return 50;
@@ -62,7 +61,7 @@ Widget* basic1(Application &app) {
             GroupBox *radios = new GroupBox(Align::Vertical, "RadioButtons");
                 std::shared_ptr<RadioGroup> radio_group = std::make_shared<RadioGroup>();
                 radios->append(new RadioButton(radio_group, "Radio 1"));
-                radio_group->buttons[0]->m_is_checked = true;
+                radio_group->buttons[0]->setChecked(true);
                 radios->append(new RadioButton(radio_group, "Radio 2"));
                 radios->append(new RadioButton(radio_group, "Radio 3, Expandable"), Fill::Both);
             check_and_radio->append(radios, Fill::Both);
@@ -78,9 +77,9 @@ Widget* basic1(Application &app) {
             // TODO look at off and use a thread to continously update one the progressbars
             progress->append(new ProgressBar(200));
             progress->append(new ProgressBar(300));
-            ((ProgressBar*)progress->children[1])->m_value = 0.50;
+            ((ProgressBar*)progress->children[1])->setValue(0.50);
             progress->append(new ProgressBar(), Fill::Horizontal);
-            ((ProgressBar*)progress->children[2])->m_value = 1.0;
+            ((ProgressBar*)progress->children[2])->setValue(1.0);
         box->append(progress, Fill::Horizontal);
 
     return box;
@@ -247,12 +246,12 @@ int main(int argc, char **argv) {
         Box *h_box = new Box(Align::Horizontal);
             auto light = new Button("Light");
                 light->onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
-                    app->dc->default_style = app->dc->default_light_style;
+                    app->dc->setDefaultStyle(app->dc->default_light_style);
                 });
             h_box->append(light);
             auto dark = new Button("Dark");
                 dark->onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
-                    app->dc->default_style = app->dc->default_dark_style;
+                    app->dc->setDefaultStyle(app->dc->default_dark_style);
                 });
             h_box->append(dark);
         app->append(h_box);
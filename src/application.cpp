@@ -47,5 +47,11 @@ Application::Application(const char *title, Size size) : Window(title, size) {
 }
 
 Application::~Application() {
+    // The shared fonts and their atlas live in the GL context of the
+    // application, which goes away with the Window. Widgets can own fonts
+    // created directly so they have to be gone before that.
+    delete m_main_widget;
+    m_main_widget = nullptr;
+    FontCache::get()->clear();
     SDL_Quit();
 }
\ No newline at end of file
@@ -45,17 +45,21 @@
             int scroll_amount = 50;
             void setMouseCursor(Cursor cursor);
             static Application* get();
+            /// Icons are packed into the atlas of the main window so that
+            /// they all share a single texture slot when drawn.
+            /// The color picker gradient gets read back from the GPU
+            /// and so it keeps its own texture.
             std::unordered_map<std::string, std::shared_ptr<Texture>> icons = {
-                {"close", std::make_shared<Texture>(close_png, close_png_length)},
-                {"close_thin", std::make_shared<Texture>(close_thin_png, close_thin_png_length)},
-                {"up_arrow", std::make_shared<Texture>(up_arrow_png, up_arrow_png_length)},
-                {"tree_layout", std::make_shared<Texture>(tree_layout_png, tree_layout_png_length)},
-                {"table_layout", std::make_shared<Texture>(table_layout_png, table_layout_png_length)},
-                {"check_button_unchecked", std::make_shared<Texture>(check_button_unchecked_png, check_button_unchecked_png_length)},
-                {"check_button_checked", std::make_shared<Texture>(check_button_checked_png, check_button_checked_png_length)},
-                {"radio_button_unchecked", std::make_shared<Texture>(radio_button_unchecked_png, radio_button_unchecked_png_length)},
-                {"radio_button_checked", std::make_shared<Texture>(radio_button_checked_png, radio_button_checked_png_length)},
-                {"radio_button_background", std::make_shared<Texture>(radio_button_background_png, radio_button_background_png_length)},
+                {"close", dc->atlas->add(close_png, close_png_length)},
+                {"close_thin", dc->atlas->add(close_thin_png, close_thin_png_length)},
+                {"up_arrow", dc->atlas->add(up_arrow_png, up_arrow_png_length)},
+                {"tree_layout", dc->atlas->add(tree_layout_png, tree_layout_png_length)},
+                {"table_layout", dc->atlas->add(table_layout_png, table_layout_png_length)},
+                {"check_button_unchecked", dc->atlas->add(check_button_unchecked_png, check_button_unchecked_png_length)},
+                {"check_button_checked", dc->atlas->add(check_button_checked_png, check_button_checked_png_length)},
+                {"radio_button_unchecked", dc->atlas->add(radio_button_unchecked_png, radio_button_unchecked_png_length)},
+                {"radio_button_checked", dc->atlas->add(radio_button_checked_png, radio_button_checked_png_length)},
+                {"radio_button_background", dc->atlas->add(radio_button_background_png, radio_button_background_png_length)},
                 {"color_picker_gradient", std::make_shared<Texture>(color_picker_gradient_png, color_picker_gradient_png_length)},
             };
 
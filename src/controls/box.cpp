@@ -128,7 +128,7 @@ void Box::layoutChildren(DrawingContext &dc, Rect rect) {
             child->rect = widget_rect;
         } else {
             if (child->isVisible()) {
-                child->draw(dc, widget_rect, child->state());
+                child->drawCached(dc, widget_rect, child->state());
             }
             // TODO this seems dumb, use window dimensions instead
             // right it would never finish drawing early because the widget in a box
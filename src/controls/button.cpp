@@ -96,7 +96,7 @@ Size Button::sizeHint(DrawingContext &dc) {
     }
 }
 
-std::string Button::text() {
+const std::string& Button::text() {
     return m_text;
 }
 
@@ -15,7 +15,7 @@
             virtual const char* name() override;
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
-            std::string text();
+            const std::string& text();
             Button* setText(std::string text);
             Image* image();
             Button* setImage(Image *image);
@@ -6,8 +6,7 @@ CheckButton::CheckButton(std::string text, bool is_checked) : Widget(), m_text{t
     m_unchecked_image = new Image(Application::get()->icons["check_button_unchecked"]);
 
     onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
-        if (m_is_checked) { m_is_checked = false; }
-        else { m_is_checked = true; }
+        setChecked(!m_is_checked);
         onValueChanged.notify(m_is_checked);
     });
 }
@@ -74,3 +73,27 @@ Size CheckButton::sizeHint(DrawingContext &dc) {
     }
     return m_size;
 }
+
+const std::string& CheckButton::text() {
+    return m_text;
+}
+
+CheckButton* CheckButton::setText(std::string text) {
+    m_text = text;
+    layout();
+
+    return this;
+}
+
+bool CheckButton::isChecked() {
+    return m_is_checked;
+}
+
+CheckButton* CheckButton::setChecked(bool is_checked) {
+    if (m_is_checked != is_checked) {
+        m_is_checked = is_checked;
+        update();
+    }
+
+    return this;
+}
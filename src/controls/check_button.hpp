@@ -15,6 +15,11 @@
             virtual const char* name() override;
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
+            const std::string& text();
+            CheckButton* setText(std::string text);
+            bool isChecked();
+            /// Sets the value without notifying `onValueChanged`.
+            CheckButton* setChecked(bool is_checked);
 
             std::string m_text = "";
             Image *m_checked_image = nullptr;
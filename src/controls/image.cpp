@@ -1,13 +1,14 @@
 #include "image.hpp"
+#include "../application.hpp"
 
 Image::Image(std::string file_path) : Widget() {
-    m_texture = std::make_shared<Texture>(file_path);
+    m_texture = Application::get()->dc->atlas->add(file_path);
     m_size = originalSize();
     style.widget_background = COLOR_NONE;
 }
 
 Image::Image(const unsigned char *image_data, int length) : Widget() {
-    m_texture = std::make_shared<Texture>(image_data, length);
+    m_texture = Application::get()->dc->atlas->add(image_data, length);
     m_size = originalSize();
     style.widget_background = COLOR_NONE;
 }
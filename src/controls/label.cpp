@@ -42,7 +42,7 @@ Size Label::sizeHint(DrawingContext &dc) {
     }
 }
 
-std::string Label::text() {
+const std::string& Label::text() {
     return m_text;
 }
 
@@ -83,3 +83,16 @@ Label* Label::setVerticalAlignment(VerticalAlignment text_align) {
 
     return this;
 }
+
+int Label::lineSpacing() {
+    return m_line_spacing;
+}
+
+Label* Label::setLineSpacing(int line_spacing) {
+    if (m_line_spacing != line_spacing) {
+        m_line_spacing = line_spacing;
+        layout();
+    }
+
+    return this;
+}
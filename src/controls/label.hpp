@@ -13,12 +13,14 @@
             virtual const char* name() override;
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
-            std::string text();
+            const std::string& text();
             virtual Label* setText(std::string text);
             HorizontalAlignment horizontalAlignment();
             Label* setHorizontalAlignment(HorizontalAlignment text_align);
             VerticalAlignment verticalAlignment();
             Label* setVerticalAlignment(VerticalAlignment text_align);
+            int lineSpacing();
+            Label* setLineSpacing(int line_spacing);
 
             std::string m_text;
             HorizontalAlignment m_horizontal_align = HorizontalAlignment::Left;
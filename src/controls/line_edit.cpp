@@ -265,7 +265,7 @@ Size LineEdit::sizeHint(DrawingContext &dc) {
     }
 }
 
-std::string LineEdit::text() {
+const std::string& LineEdit::text() {
     return m_text;
 }
 
@@ -424,7 +424,7 @@ LineEdit* LineEdit::setPlaceholderText(std::string text) {
     return this;
 }
 
-std::string LineEdit::placeholderText() {
+const std::string& LineEdit::placeholderText() {
     return m_placeholder_text;
 }
 
@@ -477,7 +477,7 @@ void LineEdit::deleteSelection(bool skip) {
         m_history.append({HistoryItem::Action::Delete, m_text.substr(m_selection.begin, m_selection.end - m_selection.begin), m_selection});
     }
     // Remove selected text.
-    setText(text().erase(m_selection.begin, m_selection.end - m_selection.begin));
+    setText(std::string(text()).erase(m_selection.begin, m_selection.end - m_selection.begin));
 
     // Reset selection after deletion.
     m_selection.x_end = m_selection.x_begin;
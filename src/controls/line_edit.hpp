@@ -67,7 +67,7 @@
             virtual Size sizeHint(DrawingContext &dc) override;
             virtual void handleTextEvent(DrawingContext &dc, const char *text);
             LineEdit* setText(std::string text);
-            std::string text();
+            const std::string& text();
             int minLength();
             LineEdit* setMinLength(int length);
             LineEdit* moveCursorLeft();
@@ -77,7 +77,7 @@
             LineEdit* deleteAt(size_t index, bool skip = false);
             LineEdit* clear();
             LineEdit* setPlaceholderText(std::string text);
-            std::string placeholderText();
+            const std::string& placeholderText();
             LineEdit* updateView();
             LineEdit* jumpWordLeft();
             LineEdit* jumpWordRight();
@@ -20,6 +20,7 @@ void NoteBookTabBar::draw(DrawingContext &dc, Rect rect, int state) {
     if (rect.w < m_size.w) {
         if (!m_horizontal_scrollbar) {
             m_horizontal_scrollbar = new SimpleScrollBar(Align::Horizontal, Size(3, 3));
+            m_horizontal_scrollbar->parent = this;
         }
         x -= m_horizontal_scrollbar->m_slider->m_value * (m_size.w - rect.w);
     } else {
@@ -35,7 +36,7 @@ void NoteBookTabBar::draw(DrawingContext &dc, Rect rect, int state) {
         if (x + child_hint.w < rect.x) {
             child->rect = child_rect;
         } else {
-            child->draw(dc, child_rect, child->state());
+            child->drawCached(dc, child_rect, child->state());
             if ((x + child_hint.w) > (rect.x + rect.w)) {
                 break;
             }
@@ -125,6 +126,11 @@ bool NoteBookTabBar::handleScrollEvent(ScrollEvent event) {
     return false;
 }
 
+void NoteBookTabBar::translate(Point offset) {
+    Widget::translate(offset);
+    if (m_horizontal_scrollbar) { m_horizontal_scrollbar->translate(offset); }
+}
+
 NoteBookTabButton::NoteBookTabButton(NoteBook *notebook, std::string text, Image *image,  bool close_button) : Button(text) {
     if (image) {
         setImage(image);
@@ -307,7 +313,7 @@ void NoteBookTabButton::setCloseButton(bool close_button) {
 }
 
 NoteBook::NoteBook() {
-
+    m_tabs->parent = this;
 }
 
 NoteBook::~NoteBook() {
@@ -324,7 +330,7 @@ void NoteBook::draw(DrawingContext &dc, Rect rect, int state) {
         rect.h -= tab_bar_size.h;
 
         // Tab content.
-        this->children[m_tab_index]->draw(dc, rect, children[m_tab_index]->state());
+        this->children[m_tab_index]->drawCached(dc, rect, children[m_tab_index]->state());
     }
 }
 
@@ -444,3 +450,8 @@ void* NoteBook::propagateMouseEvent(Window *window, State *state, MouseEvent eve
     this->handleMouseEvent(window, state, event);
     return this;
 }
+
+void NoteBook::translate(Point offset) {
+    Widget::translate(offset);
+    m_tabs->translate(offset);
+}
@@ -18,6 +18,7 @@
             virtual bool isLayout() override;
             virtual void* propagateMouseEvent(Window *window, State *state, MouseEvent event) override;
             virtual bool handleScrollEvent(ScrollEvent event) override;
+            virtual void translate(Point offset) override;
     };
 
     class NoteBook : public Widget {
@@ -29,6 +30,7 @@
             virtual Size sizeHint(DrawingContext &dc) override;
             virtual bool isLayout() override;
             virtual void* propagateMouseEvent(Window *window, State *state, MouseEvent event) override;
+            virtual void translate(Point offset) override;
             NoteBook* appendTab(Widget *root, std::string text, Image *icon = nullptr, bool close_button = false);
             // NoteBook* insertTab(Widget *root, std::string text, Image *icon = nullptr, bool close_button = false);
             NoteBook* destroyTab(size_t index);
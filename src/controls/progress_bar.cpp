@@ -1,3 +1,5 @@
+#include <cstdio>
+
 #include "progress_bar.hpp"
 
 ProgressBar::ProgressBar(int custom_width) : m_custom_width{custom_width} {}
@@ -17,13 +19,15 @@ void ProgressBar::draw(DrawingContext &dc, Rect rect, int state) {
     dc.padding(rect, style);
     fill_end = rect.w * m_value; // We have to recalculate the value again since we don't want to take the padding into account.
 
-    std::string percent_text = std::to_string((int)(m_value * 100)) + "%";
+    char buffer[16];
+    Slice<const char> percent_text = Slice<const char>(buffer, snprintf(buffer, sizeof(buffer), "%d%%", (int)(m_value * 100)));
     int text_width = dc.measureText(font(), percent_text).w;
     int text_start = (rect.w / 2) - (text_width / 2);
     size_t begin = 0;
     size_t end = 0;
     if (fill_end > text_start) {
-        for (char c : percent_text) {
+        for (size_t i = 0; i < percent_text.length; i++) {
+            char c = percent_text.data[i];
             int len = dc.measureText(font(), c).w;
             text_start += len;
             if (fill_end > text_start - len / 2) {
@@ -46,6 +50,15 @@ void ProgressBar::draw(DrawingContext &dc, Rect rect, int state) {
     );
 }
 
+ProgressBar* ProgressBar::setValue(double value) {
+    if (value < m_min) { value = m_min; }
+    if (value > m_max) { value = m_max; }
+    m_value = value;
+    update();
+
+    return this;
+}
+
 Size ProgressBar::sizeHint(DrawingContext &dc) {
     if (m_size_changed) {
         Size s = dc.measureText(font(), "100%");
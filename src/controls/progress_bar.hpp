@@ -10,6 +10,8 @@
             virtual const char* name() override;
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
+            /// Clamps the value between `m_min` and `m_max` and redraws the bar.
+            ProgressBar* setValue(double value);
 
             double m_min = 0.0;
             double m_max = 1.0;
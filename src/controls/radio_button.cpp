@@ -15,9 +15,9 @@ RadioButton::RadioButton(std::shared_ptr<RadioGroup> group, std::string text) :
 
     onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
         for (auto child : m_group->buttons) {
-            child->m_is_checked = false;
+            child->setChecked(false);
         }
-        m_is_checked = true;
+        setChecked(true);
         m_group->onValueChanged.notify(this);
     });
 }
@@ -78,11 +78,7 @@ ScrollBar::ScrollBar(Align alignment) : Box(alignment) {
         m_begin_button->image()->counterClockwise90();
     }
     m_begin_button->onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
-        m_slider->m_value -= m_slider->m_step;
-        if (m_slider->m_value < m_slider->m_min) {
-            m_slider->m_value = m_slider->m_min;
-        }
-        update();
+        m_slider->setValue(m_slider->m_value - m_slider->m_step);
     });
     append(m_begin_button, Fill::None);
 
@@ -95,11 +91,7 @@ ScrollBar::ScrollBar(Align alignment) : Box(alignment) {
         m_end_button->image()->clockwise90();
     }
     m_end_button->onMouseClick.addEventListener([&](Widget *widget, MouseEvent event) {
-        m_slider->m_value += m_slider->m_step;
-        if (m_slider->m_value > m_slider->m_max) {
-            m_slider->m_value = m_slider->m_max;
-        }
-        update();
+        m_slider->setValue(m_slider->m_value + m_slider->m_step);
     });
     append(m_end_button, Fill::None);
 
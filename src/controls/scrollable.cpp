@@ -30,17 +30,20 @@ Point Scrollable::automaticallyAddOrRemoveScrollBars(DrawingContext &dc, Rect &r
         vert = true;
         if (!m_vertical_scrollbar) {
             m_vertical_scrollbar = new ScrollBar(Align::Vertical);
+            m_vertical_scrollbar->parent = this;
         }
         rect.w -= m_vertical_scrollbar->sizeHint(dc).w;
     }
     if (rect.w < virtual_size.w) {
         if (!m_horizontal_scrollbar) {
             m_horizontal_scrollbar = new ScrollBar(Align::Horizontal);
+            m_horizontal_scrollbar->parent = this;
         }
         rect.h -= m_horizontal_scrollbar->sizeHint(dc).h;
         if (rect.h < virtual_size.h) {
             if (!m_vertical_scrollbar) {
                 m_vertical_scrollbar = new ScrollBar(Align::Vertical);
+                m_vertical_scrollbar->parent = this;
             }
             if (!vert) {
                 rect.w -= m_vertical_scrollbar->sizeHint(dc).w;
@@ -118,6 +121,12 @@ void Scrollable::drawScrollBars(DrawingContext &dc, Rect &rect, const Size &virt
     }
 }
 
+void Scrollable::translate(Point offset) {
+    Widget::translate(offset);
+    if (m_vertical_scrollbar) { m_vertical_scrollbar->translate(offset); }
+    if (m_horizontal_scrollbar) { m_horizontal_scrollbar->translate(offset); }
+}
+
 bool Scrollable::isLayout() {
     return true;
 }
@@ -29,6 +29,7 @@
             virtual bool isScrollable() override;
             virtual void* propagateMouseEvent(Window *window, State *state, MouseEvent event) override;
             virtual bool handleScrollEvent(ScrollEvent event) override;
+            virtual void translate(Point offset) override;
             Point automaticallyAddOrRemoveScrollBars(DrawingContext &dc, Rect &rect, const Size &virtual_size);
             void drawScrollBars(DrawingContext &dc, Rect &rect, const Size &virtual_size);
             Size minSize();
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "../application.hpp"
 #include "scrolled_box.hpp"
 
@@ -7,6 +9,7 @@ ScrolledBox::ScrolledBox(Align align_policy, Size min_size) : Scrollable(min_siz
 
 ScrolledBox::~ScrolledBox() {
     // ScrollBars are taken care of by Scrollable.
+    delete m_layer;
 }
 
 const char* ScrolledBox::name() {
@@ -19,19 +22,30 @@ void ScrolledBox::draw(DrawingContext &dc, Rect rect, int state) {
     // TODO clips before scrollbars which means that
     // some scrolled content can get drawn underneath when horizontall scrolling for example
     clip();
-    dc.fillRect(rect, dc.windowBackground(style));
-    layoutChildren(dc, rect);
+    if (m_layer) {
+        drawLayered(dc, rect);
+    } else {
+        dc.fillRect(rect, dc.windowBackground(style));
+        layoutChildren(dc, rect);
+    }
     dc.setClip(previous_clip);
 }
 
 void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
     sizeHint(dc);
+    Point pos = automaticallyAddOrRemoveScrollBars(dc, rect, m_size);
+    if (drawChildren(dc, rect, pos, rect)) {
+        drawScrollBars(dc, rect, m_size);
+    }
+}
+
+bool ScrolledBox::drawChildren(DrawingContext &dc, Rect rect, Point pos, Rect area) {
     Align parent_layout = m_align_policy;
     int generic_non_expandable_widgets;
-    Point pos;
     int generic_total_layout_length;
     int *generic_position_coord;
-    int *generic_rect_coord;
+    int *generic_area_coord;
+    int *area_length;
     int *rect_length;
     int *rect_opposite_length;
     Size size; // Individual widget size.
@@ -40,7 +54,8 @@ void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
         generic_non_expandable_widgets = m_vertical_non_expandable;
         generic_total_layout_length = m_widgets_only.h;
         generic_position_coord = &pos.y;
-        generic_rect_coord = &rect.y;
+        generic_area_coord = &area.y;
+        area_length = &area.h;
         rect_length = &rect.h;
         rect_opposite_length = &rect.w;
         generic_length = &size.h;
@@ -48,14 +63,13 @@ void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
         generic_non_expandable_widgets = m_horizontal_non_expandable;
         generic_total_layout_length = m_widgets_only.w;
         generic_position_coord = &pos.x;
-        generic_rect_coord = &rect.x;
+        generic_area_coord = &area.x;
+        area_length = &area.w;
         rect_length = &rect.w;
         rect_opposite_length = &rect.h;
         generic_length = &size.w;
     }
 
-    pos = automaticallyAddOrRemoveScrollBars(dc, rect, m_size);
-
     int child_count = m_visible_children - generic_non_expandable_widgets;
     if (!child_count) {
         child_count = 1; // Protects from division by zero
@@ -67,12 +81,7 @@ void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
         remainder = 0;
     }
 
-    size_t scroll_offset = 0;
-    if (m_align_policy == Align::Vertical) {
-        scroll_offset = (m_vertical_scrollbar ? m_vertical_scrollbar->m_slider->m_value : 0.0) * (m_size.h - rect.h);
-    } else {
-        scroll_offset = (m_horizontal_scrollbar ? m_horizontal_scrollbar->m_slider->m_value : 0.0) * (m_size.w - rect.w);
-    }
+    size_t scroll_offset = *generic_area_coord - *generic_position_coord;
     BinarySearchResult<Widget*> result = binarySearch(scroll_offset);
     if (result.value) {
         size_t i = result.index;
@@ -89,8 +98,8 @@ void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
                     m_children_positions[i] = BinarySearchData{ expandable_coord, (size_t)*generic_length };
                     expandable_coord += *generic_length;
                 }
-                child->draw(dc, widget_rect, child->state());
-                if ((*generic_position_coord + *generic_length) >= (*generic_rect_coord + *rect_length)) {
+                child->drawCached(dc, widget_rect, child->state());
+                if ((*generic_position_coord + *generic_length) >= (*generic_area_coord + *area_length)) {
                     break;
                 }
                 *generic_position_coord += *generic_length;
@@ -99,8 +108,127 @@ void ScrolledBox::layoutChildren(DrawingContext &dc, Rect rect) {
             child = children[i];
             if (i == children.size()) { break; }
         }
-        drawScrollBars(dc, rect, m_size);
+        return true;
+    }
+    return false;
+}
+
+static void translateChildren(std::vector<Widget*> &children, Point offset) {
+    for (Widget *child : children) {
+        child->translate(offset);
+    }
+}
+
+// Returns the parts of `rect` not covered by `covered`, relative to `rect`.
+static size_t exposedRegions(Rect rect, Rect covered, Rect *regions) {
+    int x0 = std::max(rect.x, covered.x);
+    int y0 = std::max(rect.y, covered.y);
+    int x1 = std::min(rect.x + rect.w, covered.x + covered.w);
+    int y1 = std::min(rect.y + rect.h, covered.y + covered.h);
+    if (x0 >= x1 || y0 >= y1) {
+        regions[0] = Rect(0, 0, rect.w, rect.h);
+        return 1;
+    }
+    size_t count = 0;
+    if (rect.y < y0) { regions[count++] = Rect(0, 0, rect.w, y0 - rect.y); }
+    if (y1 < rect.y + rect.h) { regions[count++] = Rect(0, y1 - rect.y, rect.w, rect.y + rect.h - y1); }
+    if (rect.x < x0) { regions[count++] = Rect(0, y0 - rect.y, x0 - rect.x, y1 - y0); }
+    if (x1 < rect.x + rect.w) { regions[count++] = Rect(x1 - rect.x, y0 - rect.y, rect.x + rect.w - x1, y1 - y0); }
+    return count;
+}
+
+void ScrolledBox::drawLayered(DrawingContext &dc, Rect rect) {
+    sizeHint(dc);
+    Point pos = automaticallyAddOrRemoveScrollBars(dc, rect, m_size);
+    // From here on `rect` is the viewport and `pos` is where
+    // the origin of the content lands on the screen.
+    Rect content = Rect(0, 0, std::max(m_size.w, rect.w), std::max(m_size.h, rect.h));
+    Rect visible = Rect(rect.x - pos.x, rect.y - pos.y, rect.w, rect.h);
+    Size layer_size = Size(
+        std::min(content.w, std::min(rect.w * 3, SCROLLED_BOX_MAX_LAYER_SIZE)),
+        std::min(content.h, std::min(rect.h * 3, SCROLLED_BOX_MAX_LAYER_SIZE))
+    );
+    uint64_t version = dc.generation * 31 + m_layout_version;
+    version = version * 31 + rect.w;
+    version = version * 31 + rect.h;
+    for (Widget *child : children) {
+        version = version * 31 + child->m_version;
+    }
+    m_layer->resize(layer_size);
+
+    Rect held = m_layer->content;
+    bool is_held = m_layer->is_valid &&
+                   visible.x >= held.x && visible.x + visible.w <= held.x + held.w &&
+                   visible.y >= held.y && visible.y + visible.h <= held.y + held.h;
+    bool is_current = m_layer->is_valid && m_layer->version == version;
+    if (is_held && is_current) {
+        // Only the scroll position changed, the children just need to
+        // follow it for hit testing.
+        Point origin = m_layer_origin.unwrap();
+        translateChildren(children, Point(pos.x - origin.x, pos.y - origin.y));
+    } else {
+        Rect next = held;
+        if (!is_held) {
+            // Center the layer on the visible part of the content.
+            next = Rect(
+                std::max(0, std::min(visible.x - (layer_size.w - visible.w) / 2, content.w - layer_size.w)),
+                std::max(0, std::min(visible.y - (layer_size.h - visible.h) / 2, content.h - layer_size.h)),
+                layer_size.w,
+                layer_size.h
+            );
+        }
+
+        // Children get laid out in content coordinates while recording so that
+        // their cached geometry stays valid as the layer moves over the content.
+        if (m_layer_origin) {
+            Point origin = m_layer_origin.unwrap();
+            translateChildren(children, Point(-origin.x, -origin.y));
+        }
+        Rect viewport = this->rect;
+        // Nested Scrollables clip themselves to our rect.
+        this->rect = content;
+        DrawList previous;
+        std::swap(previous, m_layer->list);
+        DrawList *enclosing = dc.recording;
+        dc.beginRecording(&m_layer->list);
+        dc.setClip(content);
+        dc.fillRect(content, dc.windowBackground(style));
+        drawChildren(dc, Rect(0, 0, rect.w, rect.h), Point(0, 0), next);
+        dc.endRecording();
+        dc.recording = enclosing;
+        this->rect = viewport;
+        m_layer->list.translate(Point(-next.x, -next.y));
+
+        Rect regions[4];
+        size_t count = 0;
+        Point shift = Point(0, 0);
+        if (!m_layer->is_valid || (!is_held && !is_current)) {
+            regions[count++] = Rect(0, 0, layer_size.w, layer_size.h);
+        } else if (!is_held) {
+            shift = Point(held.x - next.x, held.y - next.y);
+            count = exposedRegions(next, held, regions);
+        } else {
+            Rect damage = m_layer->list.damage(previous, Rect(0, 0, layer_size.w, layer_size.h), dc.renderer);
+            if (damage.w > 0 && damage.h > 0) { regions[count++] = damage; }
+        }
+        if (count) {
+            m_layer->update(dc.renderer, shift, regions, count);
+        }
+        m_layer->content = next;
+        m_layer->version = version;
+        m_layer->is_valid = true;
+        translateChildren(children, pos);
     }
+    m_layer_origin = Option<Point>(pos);
+
+    TextureCoordinates coords = m_layer->coordinates(Rect(
+        visible.x - m_layer->content.x,
+        visible.y - m_layer->content.y,
+        visible.w,
+        visible.h
+    ));
+    dc.drawTexture(Point(rect.x, rect.y), Size(rect.w, rect.h), m_layer->texture(), &coords);
+    drawScrollBars(dc, rect, m_size);
 }
 
 Size ScrolledBox::sizeHint(DrawingContext &dc) {
@@ -160,6 +288,7 @@ Size ScrolledBox::sizeHint(DrawingContext &dc) {
         m_size = size;
         m_widgets_only = size;
         m_size_changed = false;
+        m_layout_version++;
 
         return m_viewport;
     } else {
@@ -192,6 +321,21 @@ Align ScrolledBox::alignPolicy() {
     return m_align_policy;
 }
 
+void ScrolledBox::setLayered(bool layered) {
+    if (layered == isLayered()) { return; }
+    if (layered) {
+        m_layer = new Layer();
+    } else {
+        delete m_layer;
+        m_layer = nullptr;
+    }
+    update();
+}
+
+bool ScrolledBox::isLayered() {
+    return m_layer != nullptr;
+}
+
 Size ScrolledBox::calculateChildSize(Size child_hint, int expandable_length, int rect_opposite_length, Widget *child, int &remainder) {
     Size size;
     int child_expandable_length = expandable_length;
@@ -3,6 +3,10 @@
 
     #include "scrollable.hpp"
     #include "../option.hpp"
+    #include "../renderer/layer.hpp"
+
+    // The largest a layer gets along either axis, in pixels.
+    #define SCROLLED_BOX_MAX_LAYER_SIZE 4096
 
     class ScrolledBox : public Scrollable {
         public:
@@ -12,10 +16,25 @@
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
             void layoutChildren(DrawingContext &dc, Rect rect);
+            /// Draws the children that intersect `area`, they are sized for the
+            /// viewport `rect` and the origin of the content lands on `pos`.
+            /// Returns false when there was nothing to draw.
+            bool drawChildren(DrawingContext &dc, Rect rect, Point pos, Rect area);
+            void drawLayered(DrawingContext &dc, Rect rect);
             virtual bool handleScrollEvent(ScrollEvent event) override;
             void* propagateMouseEvent(Window *window, State *state, MouseEvent event) override;
             void setAlignPolicy(Align align_policy);
             Align alignPolicy();
+            /// Turns layered drawing on or off.
+            /// A layered ScrolledBox renders its content into an offscreen
+            /// buffer up to three times the size of the viewport. Scrolling
+            /// within it only draws part of the buffer, scrolling past it
+            /// only renders the newly exposed strips and an update() from
+            /// a child only renders the area that changed.
+            /// Children are moved with translate() instead of being drawn
+            /// again so they have to lay everything out from their rect.
+            void setLayered(bool layered);
+            bool isLayered();
             Size calculateChildSize(Size child_hint, int expandable_length, int rect_opposite_length, Widget *child, int &remainder);
 
             Align m_align_policy = Align::Horizontal;
@@ -24,7 +43,15 @@
             unsigned int m_visible_children = 0;
 
             Size m_widgets_only; // The layout's size without padding, border, margin etc.
+            /// Bumped whenever the sizes of the children get recomputed.
+            uint64_t m_layout_version = 0;
+            /// Where the origin of the content was on the screen when
+            /// the children were last moved along with the layer.
+            Option<Point> m_layer_origin;
             std::vector<BinarySearchData> m_children_positions;
             BinarySearchResult<Widget*> binarySearch(size_t position);
+
+        protected:
+            Layer *m_layer = nullptr;
     };
 #endif
@@ -82,10 +82,9 @@ Slider::Slider(Align alignment, double value) : Box(alignment), m_value{value} {
 
             int start = size - m_origin;
             double value = (event_pos - (position + start)) / (double)(length - start - m_origin);
-            m_value = NORMALIZE(m_min, m_max, value);
+            setValue(value);
 
             onValueChanged.notify();
-            update();
         }
     });
 
@@ -93,11 +92,10 @@ Slider::Slider(Align alignment, double value) : Box(alignment), m_value{value} {
         Rect rect = this->rect;
         int size = m_slider_button_size;
         if (m_align_policy == Align::Horizontal) {
-            m_value = (event.x - (rect.x + size / 2.0)) / (double)(rect.w - size);
+            setValue((event.x - (rect.x + size / 2.0)) / (double)(rect.w - size));
         } else {
-            m_value = (event.y - (rect.y + size / 2.0)) / (double)(rect.h - size);
+            setValue((event.y - (rect.y + size / 2.0)) / (double)(rect.h - size));
         }
-        m_value = NORMALIZE(m_min, m_max, m_value);
     });
 }
 
@@ -168,9 +166,15 @@ Size Slider::sizeHint(DrawingContext &dc) {
 bool Slider::handleScrollEvent(ScrollEvent event) {
     // TODO should we do this automatically in ScrollEvent() ctor?
     event.y *= -1;
-    m_value = NORMALIZE(m_min, m_max, m_value + m_step * event.y);
+    setValue(m_value + m_step * event.y);
 
     onValueChanged.notify();
-    update();
     return true;
 }
+
+Slider* Slider::setValue(double value) {
+    m_value = NORMALIZE(m_min, m_max, value);
+    update();
+
+    return this;
+}
@@ -32,5 +32,7 @@
             virtual void draw(DrawingContext &dc, Rect rect, int state) override;
             virtual Size sizeHint(DrawingContext &dc) override;
             virtual bool handleScrollEvent(ScrollEvent event) override;
+            /// Clamps the value between `m_min` and `m_max` and redraws the slider.
+            Slider* setValue(double value);
     };
 #endif
@@ -11,6 +11,7 @@ class Splitter : public Widget {
         virtual Size sizeHint(DrawingContext &dc);
         virtual void* propagateMouseEvent(Window *window, State *state, MouseEvent event);
         virtual  bool isLayout() override;
+        virtual void translate(Point offset) override;
         void append();
         void top(Widget *widget);
         void bottom(Widget *widget);
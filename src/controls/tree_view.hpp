@@ -479,7 +479,7 @@
                             local_pos_x + s.w > rect.x + rect.w ? (rect.x + rect.w) - local_pos_x : s.w,
                             m_children_size.h
                         ).clipTo(tv_clip).clipTo(rect));
-                        child->draw(dc, Rect(local_pos_x, rect.y, s.w, m_children_size.h), child->state());
+                        child->drawCached(dc, Rect(local_pos_x, rect.y, s.w, m_children_size.h), child->state());
                     }
                     local_pos_x += s.w;
                     i++;
@@ -7,6 +7,7 @@ Widget::Widget() {
 
 Widget::~Widget() {
     Application::get()->removeFromState(this);
+    delete m_cache;
     for (Widget *child : this->children) {
         delete child;
     }
@@ -108,6 +109,11 @@ int Widget::state() {
 }
 
 Widget* Widget::update() {
+    Widget *widget = this;
+    while (widget) {
+        widget->m_version++;
+        widget = widget->parent;
+    }
     Application::get()->update();
 
     return this;
@@ -128,6 +134,66 @@ Widget* Widget::layout() {
     return this;
 }
 
+void Widget::translate(Point offset) {
+    rect.x += offset.x;
+    rect.y += offset.y;
+    inner_rect.x += offset.x;
+    inner_rect.y += offset.y;
+    for (Widget *child : children) {
+        child->translate(offset);
+    }
+}
+
+// Returns `widget` when it is `root` or one of its descendants.
+static void* withinSubtree(Widget *root, void *widget) {
+    for (Widget *w = (Widget*)widget; w; w = w->parent) {
+        if (w == root) { return widget; }
+    }
+    return nullptr;
+}
+
+void Widget::drawCached(DrawingContext &dc, Rect rect, int state) {
+    State *app_state = Application::get()->m_state;
+    void *hovered = withinSubtree(this, app_state->hovered);
+    void *pressed = withinSubtree(this, app_state->pressed);
+    void *focused = withinSubtree(this, app_state->focused);
+    Rect clip = dc.clip();
+    if (m_cache &&
+        m_cache->version == m_version &&
+        m_cache->generation == dc.generation &&
+        m_cache->state == state &&
+        m_cache->rect == rect &&
+        m_cache->clip == clip &&
+        m_cache->hovered == hovered &&
+        m_cache->pressed == pressed &&
+        m_cache->focused == focused) {
+        dc.replay(m_cache->list);
+        return;
+    }
+    if (!m_cache) {
+        m_cache = new GeometryCache();
+    }
+    // Recording nests, an enclosing Widget gets our primitives
+    // appended to its own list once we are done.
+    // The version is taken before drawing so that an update() from
+    // within draw() still misses on the next frame.
+    uint64_t version = m_version;
+    DrawList *enclosing = dc.recording;
+    dc.beginRecording(&m_cache->list);
+    draw(dc, rect, state);
+    dc.endRecording();
+    dc.recording = enclosing;
+    m_cache->version = version;
+    m_cache->generation = dc.generation;
+    m_cache->state = state;
+    m_cache->rect = rect;
+    m_cache->clip = clip;
+    m_cache->hovered = hovered;
+    m_cache->pressed = pressed;
+    m_cache->focused = focused;
+    dc.replay(m_cache->list);
+}
+
 void* Widget::propagateMouseEvent(Window *window, State *state, MouseEvent event) {
     for (Widget *child : children) {
         if (child->isVisible()) {
@@ -115,6 +115,21 @@
             /// color theme values.
             virtual void draw(DrawingContext &dc, Rect rect, int state) = 0;
 
+            /// This method draws the Widget through its geometry cache.
+            /// When the rect, state, clip and content version all match
+            /// the previous call the primitives recorded for the whole
+            /// subtree get replayed instead of running draw() again.
+            /// The content version is bumped by update() and layout(),
+            /// which every setter of a Widget calls. Anything a Widget
+            /// draws has to change through one, or be followed by update().
+            void drawCached(DrawingContext &dc, Rect rect, int state);
+
+            /// This method moves the Widget, and everything it lays out,
+            /// by `offset` without drawing it again.
+            /// Widgets that keep Widgets outside of `children` have to
+            /// move those as well.
+            virtual void translate(Point offset);
+
             /// This method is used to add a Widget to the children
             /// of the Widget in question. It adds the Widget to the
             /// end of the children dynamic array.
@@ -224,6 +239,27 @@
             /// needs to be recomputed.
             bool m_size_changed = true;
 
+            /// The primitives emitted by the last drawCached() miss
+            /// along with the inputs they were recorded for.
+            struct GeometryCache {
+                DrawList list;
+                Rect rect;
+                Rect clip;
+                int state = STATE_DEFAULT;
+                uint64_t version = 0;
+                uint64_t generation = 0;
+                /// The hovered, pressed and focused Widgets at record time,
+                /// or nullptr when they were outside of this subtree.
+                void *hovered = nullptr;
+                void *pressed = nullptr;
+                void *focused = nullptr;
+            };
+            GeometryCache *m_cache = nullptr;
+
+            /// Bumped by update() on this Widget and all of its parents
+            /// so that a change anywhere in a subtree misses its cache.
+            uint64_t m_version = 0;
+
             Font *m_font = nullptr;
 
             int m_binding_id = 0;
@@ -0,0 +1,207 @@
+#include <cstring>
+#include <algorithm>
+
+#include "atlas.hpp"
+
+AtlasAllocator::AtlasAllocator(int width, int height) : width{width}, height{height} {
+
+}
+
+Option<Rect> AtlasAllocator::allocate(int w, int h) {
+    if (w > width || h > height) { return Option<Rect>(); }
+    int reused = -1;
+    for (size_t i = 0; i < m_released.size(); i++) {
+        const Rect &rect = m_released[i];
+        if (rect.w >= w && rect.h >= h && (reused < 0 || rect.w * rect.h < m_released[reused].w * m_released[reused].h)) {
+            reused = i;
+        }
+    }
+    if (reused >= 0) {
+        Rect rect = m_released[reused];
+        m_released.erase(m_released.begin() + reused);
+        m_count++;
+        return Option<Rect>(rect);
+    }
+    Shelf *best = nullptr;
+    for (Shelf &shelf : m_shelves) {
+        if (shelf.height >= h && shelf.x + w <= width) {
+            if (!best || shelf.height < best->height) { best = &shelf; }
+        }
+    }
+    if (!best) {
+        if (m_next_y + h > height) { return Option<Rect>(); }
+        m_shelves.push_back(Shelf{m_next_y, h, 0});
+        m_next_y += h;
+        best = &m_shelves.back();
+    }
+    Rect rect = Rect(best->x, best->y, w, h);
+    best->x += w;
+    m_count++;
+    return Option<Rect>(rect);
+}
+
+void AtlasAllocator::release(Rect rect) {
+    m_count--;
+    if (m_count) {
+        m_released.push_back(rect);
+        return;
+    }
+    m_shelves.clear();
+    m_released.clear();
+    m_next_y = 0;
+}
+
+TextureAtlas::TextureAtlas(bool is_layered) : is_layered{is_layered}, m_self{std::make_shared<TextureAtlas*>(this)} {
+    if (is_layered) {
+        int max_layers = 0;
+        glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+        max_pages = std::max(std::min(max_layers, ATLAS_MAX_LAYERS), 1);
+    }
+}
+
+TextureAtlas::~TextureAtlas() {
+    *m_self = nullptr;
+    for (Page &page : pages) {
+        if (page.ID) { glDeleteTextures(1, &page.ID); }
+    }
+    if (array_ID) { glDeleteTextures(1, &array_ID); }
+}
+
+std::shared_ptr<Texture> TextureAtlas::add(std::string file_path) {
+    std::shared_ptr<Texture> texture = m_files[file_path].lock();
+    if (texture) { return texture; }
+    int width, height, nr_channels;
+    if (!stbi_info(file_path.c_str(), &width, &height, &nr_channels) ||
+        width > ATLAS_MAX_ENTRY_SIZE || height > ATLAS_MAX_ENTRY_SIZE) {
+        texture = std::make_shared<Texture>(file_path);
+    } else {
+        unsigned char *data = stbi_load(file_path.c_str(), &width, &height, &nr_channels, 4);
+        if (!data) { error("FAILED_TO_LOAD_TEXTURE", file_path); }
+        texture = add(data, width, height);
+        stbi_image_free(data);
+    }
+    m_files[file_path] = texture;
+    return texture;
+}
+
+static uint64_t hashData(const unsigned char *data, int length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return (hash ^ (uint64_t)length) * 1099511628211ull;
+}
+
+std::shared_ptr<Texture> TextureAtlas::add(const unsigned char *image_data, int length) {
+    assert(image_data && "Null image data!");
+    uint64_t key = hashData(image_data, length);
+    std::shared_ptr<Texture> texture = m_memory[key].lock();
+    if (texture) { return texture; }
+    int width, height, nr_channels;
+    if (!stbi_info_from_memory(image_data, length, &width, &height, &nr_channels) ||
+        width > ATLAS_MAX_ENTRY_SIZE || height > ATLAS_MAX_ENTRY_SIZE) {
+        texture = std::make_shared<Texture>(image_data, length);
+    } else {
+        unsigned char *data = stbi_load_from_memory(image_data, length, &width, &height, &nr_channels, 4);
+        if (!data) { error("FAILED_TO_LOAD_TEXTURE", ":memory:"); }
+        texture = add(data, width, height);
+        stbi_image_free(data);
+    }
+    m_memory[key] = texture;
+    return texture;
+}
+
+std::shared_ptr<Texture> TextureAtlas::add(const unsigned char *pixels, int width, int height) {
+    int padded_width = width + ATLAS_PADDING * 2;
+    int padded_height = height + ATLAS_PADDING * 2;
+    Option<Rect> region;
+    size_t page_index = 0;
+    for (; page_index < pages.size() && !region; page_index++) {
+        region = pages[page_index].allocator.allocate(padded_width, padded_height);
+    }
+    if (region) {
+        page_index--;
+    } else if (pages.size() >= max_pages) {
+        return std::make_shared<Texture>(pixels, width, height);
+    } else {
+        addPage();
+        region = pages.back().allocator.allocate(padded_width, padded_height);
+    }
+    Rect rect = region.unwrap();
+    Page &page = pages[page_index];
+
+    std::vector<unsigned char> padded(padded_width * padded_height * 4);
+    for (int y = 0; y < padded_height; y++) {
+        int source_y = std::min(std::max(y - ATLAS_PADDING, 0), height - 1);
+        for (int x = 0; x < padded_width; x++) {
+            int source_x = std::min(std::max(x - ATLAS_PADDING, 0), width - 1);
+            memcpy(&padded[(y * padded_width + x) * 4], &pixels[(source_y * width + source_x) * 4], 4);
+        }
+    }
+    glActiveTexture(GL_TEXTURE0);
+    int layer = -1;
+    if (is_layered) {
+        layer = page_index;
+        for (int y = 0; y < padded_height; y++) {
+            memcpy(
+                &page.pixels[((rect.y + y) * ATLAS_PAGE_SIZE + rect.x) * 4],
+                &padded[y * padded_width * 4],
+                padded_width * 4
+            );
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array_ID);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, rect.x, rect.y, layer, padded_width, padded_height, 1, GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+    } else {
+        glBindTexture(GL_TEXTURE_2D, page.ID);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, padded_width, padded_height, GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+    }
+
+    std::shared_ptr<TextureAtlas*> self = m_self;
+    return std::shared_ptr<Texture>(
+        new Texture(
+            page.ID,
+            width,
+            height,
+            (rect.x + ATLAS_PADDING) / (float)ATLAS_PAGE_SIZE,
+            (rect.y + ATLAS_PADDING) / (float)ATLAS_PAGE_SIZE,
+            (rect.x + ATLAS_PADDING + width) / (float)ATLAS_PAGE_SIZE,
+            (rect.y + ATLAS_PADDING + height) / (float)ATLAS_PAGE_SIZE,
+            layer
+        ),
+        [self, page_index, rect](Texture *texture) {
+            if (*self) { (*self)->pages[page_index].allocator.release(rect); }
+            delete texture;
+        }
+    );
+}
+
+void TextureAtlas::addPage() {
+    if (is_layered) {
+        pages.push_back(Page{0, AtlasAllocator(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE), std::vector<unsigned char>(ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE * 4)});
+        // Array textures can't grow so the whole thing gets recreated
+        // from the shadow copies with room for the new layer.
+        if (array_ID) { glDeleteTextures(1, &array_ID); }
+        glActiveTexture(GL_TEXTURE0);
+        glGenTextures(1, &array_ID);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array_ID);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, pages.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        for (size_t layer = 0; layer < pages.size(); layer++) {
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE, pages[layer].pixels.data());
+        }
+        return;
+    }
+    unsigned int ID;
+    glActiveTexture(GL_TEXTURE0);
+    glGenTextures(1, &ID);
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    pages.push_back(Page{ID, AtlasAllocator(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE), std::vector<unsigned char>()});
+}
@@ -0,0 +1,97 @@
+#ifndef ATLAS_HPP
+    #define ATLAS_HPP
+
+    #include <string>
+    #include <vector>
+    #include <memory>
+    #include <cassert>
+    #include <cstdint>
+    #include <unordered_map>
+
+    #include "../option.hpp"
+    #include "../common/rect.hpp"
+
+    #include "glad.h"
+    #include "texture.hpp"
+
+    #define ATLAS_PAGE_SIZE 512
+    // Anything bigger than this keeps its own GL texture.
+    #define ATLAS_MAX_ENTRY_SIZE 128
+    // Every entry gets its edge pixels repeated around it so that linear
+    // filtering never picks up texels from its neighbours.
+    #define ATLAS_PADDING 1
+    // The layer of a Texture travels in the 8 bit texture index of a vertex.
+    #define ATLAS_MAX_LAYERS 256
+
+    /// Shelf packer handing out rectangles from a fixed size area.
+    /// Rectangles get placed left to right on the shelf that wastes the least
+    /// height, a new shelf is opened below the last one when none fit.
+    /// Released rectangles get handed out again whole to anything that fits
+    /// into them, once every rectangle has been released the area starts over.
+    struct AtlasAllocator {
+        struct Shelf {
+            int y;
+            int height;
+            int x;
+        };
+
+        int width;
+        int height;
+
+        AtlasAllocator(int width, int height);
+        /// The returned rectangle can be larger than asked for when
+        /// it reuses released space, it has to be released as is.
+        Option<Rect> allocate(int w, int h);
+        void release(Rect rect);
+
+        private:
+            std::vector<Shelf> m_shelves;
+            std::vector<Rect> m_released;
+            int m_next_y = 0;
+            int m_count = 0;
+    };
+
+    /// Packs small images into shared RGBA pages so that drawing any of them
+    /// binds the same GL texture and keeps the batch going.
+    /// The returned Textures share the ID of their page and carry the
+    /// sub rectangle they occupy, which the Renderer maps
+    /// TextureCoordinates into.
+    /// A layered atlas keeps every page as a layer of `array_ID` instead
+    /// and its Textures refer to their layer. The pages are shadowed in CPU
+    /// memory so that the array can be reallocated when a page gets added.
+    /// Once `max_pages` layers are in use further images that don't fit
+    /// get a Texture of their own.
+    /// Adding the same file or encoded image again returns the Texture
+    /// already handed out for it, the space of a Texture gets released once
+    /// the last reference to it goes away. Encoded images are recognized by
+    /// their contents, a buffer that gets reused for another image is fine.
+    struct TextureAtlas {
+        struct Page {
+            unsigned int ID;
+            AtlasAllocator allocator;
+            std::vector<unsigned char> pixels;
+        };
+
+        bool is_layered = false;
+        unsigned int array_ID = 0;
+        /// At most ATLAS_MAX_LAYERS and GL_MAX_ARRAY_TEXTURE_LAYERS
+        /// for a layered atlas, unlimited otherwise.
+        size_t max_pages = SIZE_MAX;
+        std::vector<Page> pages;
+
+        TextureAtlas(bool is_layered = false);
+        ~TextureAtlas();
+        std::shared_ptr<Texture> add(std::string file_path);
+        std::shared_ptr<Texture> add(const unsigned char *image_data, int length);
+        std::shared_ptr<Texture> add(const unsigned char *pixels, int width, int height);
+
+        private:
+            /// Lets Textures outliving the atlas know that it's gone.
+            std::shared_ptr<TextureAtlas*> m_self;
+            std::unordered_map<std::string, std::weak_ptr<Texture>> m_files;
+            /// Keyed by a hash of the encoded bytes and their length.
+            std::unordered_map<uint64_t, std::weak_ptr<Texture>> m_memory;
+
+            void addPage();
+    };
+#endif
@@ -1,8 +1,24 @@
 #ifndef BATCH_HPP
     #define BATCH_HPP
 
-    #define MAX_BATCH_SIZE 1000
+    // Quads per stream buffer segment, a batch can span several segments.
+    #define BATCH_SEGMENT_SIZE 1000
     #define QUAD_VERTEX_COUNT 4
     #define QUAD_INDEX_COUNT 6
+    // 1024 * sizeof(ivec4) is the 16KB uniform block size every GL 3.3 driver supports.
+    #define MAX_CLIP_RECTS 1024
+    #define CLIP_LOOKUP_SIZE (MAX_CLIP_RECTS * 2)
+    // Clip table entry covering everything, used by quads that were culled
+    // or trimmed against the clip on the CPU already.
+    #define NO_CLIP_INDEX 0
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define AGRO_SSE2
+    #endif
+    // Upper bound for the texture units used by a batch, matching the `textures` uniform array.
+    #define MAX_TEXTURE_SLOTS 32
+    // Texture units used by the array backend, unit 0 is left for uploads.
+    #define ARRAY_TEXTURE_UNIT 1
+    #define ARRAY_TEXT_UNIT 2
+    #define ARRAY_LAYERS_UNIT 3
     
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,383 @@
+#include <cstring>
+#include <climits>
+#include <algorithm>
+
+#include "draw_list.hpp"
+#include "quad_list.hpp"
+
+// Keeps every command aligned for the pointers it holds.
+#define COMMAND_ALIGNMENT 8
+// How many commands damage() looks ahead in both lists to find
+// where they match again after a command was added or removed.
+#define DAMAGE_LOOKAHEAD 16
+
+Slice<const char> DrawList::FillTextCommand::text() const {
+    return Slice<const char>((const char*)(this + 1), length);
+}
+
+DrawList::DrawList() {
+
+}
+
+void DrawList::clear() {
+    m_arena.clear();
+    m_count = 0;
+}
+
+bool DrawList::empty() const {
+    return m_count == 0;
+}
+
+size_t DrawList::count() const {
+    return m_count;
+}
+
+size_t DrawList::size() const {
+    return m_arena.size();
+}
+
+// The arena grows with zeroed bytes and commands only ever assign their fields,
+// which leaves the padding zeroed and makes lists comparable with memcmp.
+void* DrawList::push(Type type, size_t size) {
+    size = (size + COMMAND_ALIGNMENT - 1) & ~(size_t)(COMMAND_ALIGNMENT - 1);
+    size_t offset = m_arena.size();
+    m_arena.resize(offset + size);
+    Command *command = at(offset);
+    command->type = type;
+    command->size = size;
+    m_count++;
+    return command;
+}
+
+DrawList::Command* DrawList::at(size_t offset) {
+    return (Command*)(m_arena.data() + offset);
+}
+
+void DrawList::fillRect(Rect rect, Color color) {
+    FillRectCommand *command = (FillRectCommand*)push(Type::FillRect, sizeof(FillRectCommand));
+    command->rect = rect;
+    command->color = color;
+}
+
+void DrawList::fillRectWithGradient(Rect rect, Color from_color, Color to_color, Gradient orientation) {
+    FillRectWithGradientCommand *command = (FillRectWithGradientCommand*)push(Type::FillRectWithGradient, sizeof(FillRectWithGradientCommand));
+    command->rect = rect;
+    command->from_color = from_color;
+    command->to_color = to_color;
+    command->orientation = orientation;
+}
+
+void DrawList::fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, bool is_multiline, int line_spacing, Renderer::Selection selection, Color selection_color) {
+    FillTextCommand *command = (FillTextCommand*)push(Type::FillText, sizeof(FillTextCommand) + text.length);
+    command->font = font;
+    command->point = point;
+    command->color = color;
+    command->tab_width = tab_width;
+    command->line_spacing = line_spacing;
+    command->is_multiline = is_multiline;
+    command->selection = selection;
+    command->selection_color = selection_color;
+    command->length = text.length;
+    memcpy(command + 1, text.data, text.length);
+}
+
+void DrawList::drawTexture(Point point, Size size, Texture *texture, TextureCoordinates *coords, Color color) {
+    DrawTextureCommand *command = (DrawTextureCommand*)push(Type::DrawTexture, sizeof(DrawTextureCommand));
+    command->point = point;
+    command->size = size;
+    command->texture = texture;
+    command->coords = *coords;
+    command->color = color;
+}
+
+void DrawList::setClip(Rect rect) {
+    SetClipCommand *command = (SetClipCommand*)push(Type::SetClip, sizeof(SetClipCommand));
+    command->rect = rect;
+    clip = rect;
+}
+
+void DrawList::append(const DrawList &other) {
+    m_arena.insert(m_arena.end(), other.m_arena.begin(), other.m_arena.end());
+    m_count += other.m_count;
+    clip = other.clip;
+}
+
+void DrawList::translate(Point offset) {
+    for (size_t offset_in_arena = 0; offset_in_arena < m_arena.size(); offset_in_arena += at(offset_in_arena)->size) {
+        Command *command = at(offset_in_arena);
+        switch (command->type) {
+            case Type::FillRect: {
+                Rect &rect = ((FillRectCommand*)command)->rect;
+                rect.x += offset.x;
+                rect.y += offset.y;
+                break;
+            }
+            case Type::FillRectWithGradient: {
+                Rect &rect = ((FillRectWithGradientCommand*)command)->rect;
+                rect.x += offset.x;
+                rect.y += offset.y;
+                break;
+            }
+            case Type::FillText: {
+                Point &point = ((FillTextCommand*)command)->point;
+                point.x += offset.x;
+                point.y += offset.y;
+                break;
+            }
+            case Type::DrawTexture: {
+                Point &point = ((DrawTextureCommand*)command)->point;
+                point.x += offset.x;
+                point.y += offset.y;
+                break;
+            }
+            case Type::SetClip: {
+                Rect &rect = ((SetClipCommand*)command)->rect;
+                rect.x += offset.x;
+                rect.y += offset.y;
+                break;
+            }
+        }
+    }
+    clip.x += offset.x;
+    clip.y += offset.y;
+}
+
+void DrawList::replay(Renderer *renderer, Point offset) const {
+    if (renderer->workers && m_count >= QUAD_LIST_MIN_COMMANDS) {
+        replayParallel(renderer, offset);
+        return;
+    }
+    const Command *command = first();
+    while (command) {
+        switch (command->type) {
+            case Type::FillRect:
+            case Type::FillRectWithGradient:
+                command = replayRects(renderer, command, offset);
+                continue;
+            case Type::FillText: {
+                const FillTextCommand *c = (const FillTextCommand*)command;
+                renderer->fillText(c->font, c->text(), Point(c->point.x + offset.x, c->point.y + offset.y), c->color, c->tab_width, c->is_multiline, c->line_spacing, c->selection, c->selection_color);
+                break;
+            }
+            case Type::DrawTexture: {
+                const DrawTextureCommand *c = (const DrawTextureCommand*)command;
+                TextureCoordinates coords = c->coords;
+                renderer->drawTexture(Point(c->point.x + offset.x, c->point.y + offset.y), c->size, c->texture, &coords, c->color);
+                break;
+            }
+            case Type::SetClip: {
+                const SetClipCommand *c = (const SetClipCommand*)command;
+                renderer->setClip(Rect(c->rect.x + offset.x, c->rect.y + offset.y, c->rect.w, c->rect.h));
+                break;
+            }
+        }
+        command = next(command);
+    }
+}
+
+// Consecutive rects all run under the same clip, which lets them be tested
+// against it together. Returns the command following the run.
+const DrawList::Command* DrawList::replayRects(Renderer *renderer, const Command *command, Point offset) const {
+    const Command *commands[RENDERER_CLIP_TEST_BATCH];
+    Rect rects[RENDERER_CLIP_TEST_BATCH];
+    Renderer::ClipTest tests[RENDERER_CLIP_TEST_BATCH];
+    size_t count = 0;
+    for (; command && count < RENDERER_CLIP_TEST_BATCH; command = next(command)) {
+        Rect rect;
+        if (command->type == Type::FillRect) {
+            rect = ((const FillRectCommand*)command)->rect;
+        } else if (command->type == Type::FillRectWithGradient) {
+            rect = ((const FillRectWithGradientCommand*)command)->rect;
+        } else {
+            break;
+        }
+        commands[count] = command;
+        rects[count++] = Rect(rect.x + offset.x, rect.y + offset.y, rect.w, rect.h);
+    }
+    Renderer::clipTests(rects, count, renderer->clip_rect, tests);
+    for (size_t i = 0; i < count; i++) {
+        if (commands[i]->type == Type::FillRect) {
+            Color color = ((const FillRectCommand*)commands[i])->color;
+            renderer->fillRectWithGradient(rects[i], color, color, Gradient::TopToBottom, tests[i]);
+        } else {
+            const FillRectWithGradientCommand *c = (const FillRectWithGradientCommand*)commands[i];
+            renderer->fillRectWithGradient(rects[i], c->from_color, c->to_color, c->orientation, tests[i]);
+        }
+    }
+    return command;
+}
+
+// Splits the list into ranges of about the same number of commands, the
+// clip each range starts with is found by walking the headers up front,
+// which is also when the glyphs of the text commands get prepared.
+// The ranges get turned into quads by the workers and are submitted in order
+// afterwards, which keeps the paint order of a sequential replay.
+void DrawList::replayParallel(Renderer *renderer, Point offset) const {
+    WorkerPool *workers = renderer->workers;
+    size_t range_count = std::min(workers->size() * 4, m_count / (QUAD_LIST_MIN_COMMANDS / 4));
+    size_t per_range = (m_count + range_count - 1) / range_count;
+    std::vector<const Command*> begins;
+    std::vector<Rect> clips;
+    Rect clip = renderer->clip_rect;
+    size_t i = 0;
+    for (const Command *command = first(); command; command = next(command), i++) {
+        if (i % per_range == 0) {
+            begins.push_back(command);
+            clips.push_back(clip);
+        }
+        if (command->type == Type::SetClip) {
+            Rect rect = ((const SetClipCommand*)command)->rect;
+            clip = Rect(rect.x + offset.x, rect.y + offset.y, rect.w, rect.h);
+        } else if (command->type == Type::FillText) {
+            // Glyphs can only be rasterized here, on the thread with the GL context.
+            const FillTextCommand *c = (const FillTextCommand*)command;
+            c->font->prepare(c->text());
+        }
+    }
+    begins.push_back(nullptr);
+    range_count = clips.size();
+    while (renderer->quad_lists.size() < range_count) {
+        renderer->quad_lists.push_back(new QuadList());
+    }
+
+    Option<Rect> damage = renderer->damage;
+    bool use_layers = renderer->backend == Renderer::Backend::Array;
+    workers->run(range_count, [&](size_t range) {
+        renderer->quad_lists[range]->build(*this, begins[range], begins[range + 1], clips[range], damage, use_layers, offset);
+    });
+    for (size_t range = 0; range < range_count; range++) {
+        renderer->submit(*renderer->quad_lists[range]);
+    }
+}
+
+// The painted area of a command, text is measured and padded by half a line
+// on each side since glyph bearings can reach outside of the measured box.
+Rect DrawList::bounds(const Command *command, Rect clip, Renderer *renderer) {
+    Rect rect;
+    switch (command->type) {
+        case Type::FillRect:
+            rect = ((const FillRectCommand*)command)->rect;
+            break;
+        case Type::FillRectWithGradient:
+            rect = ((const FillRectWithGradientCommand*)command)->rect;
+            break;
+        case Type::FillText: {
+            const FillTextCommand *c = (const FillTextCommand*)command;
+            Slice<const char> text = c->text();
+            Size size = renderer->measureText(c->font, text, c->tab_width, c->is_multiline, c->line_spacing);
+            int padding = c->font->max_height / 2;
+            rect = Rect(c->point.x - padding, c->point.y - padding, size.w + padding * 2, size.h + padding * 2);
+            break;
+        }
+        case Type::DrawTexture: {
+            const DrawTextureCommand *c = (const DrawTextureCommand*)command;
+            rect = Rect(c->point.x, c->point.y, c->size.w, c->size.h);
+            break;
+        }
+        case Type::SetClip:
+            return Rect();
+    }
+    return rect.clipTo(clip);
+}
+
+// A command along with the clip it runs under.
+struct Cursor {
+    const DrawList::Command *command;
+    Rect clip;
+};
+
+static void step(const DrawList &list, Cursor &cursor) {
+    if (!cursor.command) { return; }
+    if (cursor.command->type == DrawList::Type::SetClip) {
+        cursor.clip = ((const DrawList::SetClipCommand*)cursor.command)->rect;
+    }
+    cursor.command = list.next(cursor.command);
+}
+
+static bool isSame(const Cursor &a, const Cursor &b) {
+    return a.command && b.command &&
+           a.command->size == b.command->size &&
+           a.clip == b.clip &&
+           !memcmp(a.command, b.command, a.command->size);
+}
+
+// Walks both lists side by side. Where they differ the nearest pair of
+// matching commands within the lookahead realigns them, so that a command
+// added or removed only damages itself rather than everything after it.
+// Commands that got skipped to realign are damaged, when there is no match
+// close enough the differing pair gets damaged and the walk moves on.
+// Matched commands keep their order, so outside of the damage both
+// lists paint the same pixels.
+Rect DrawList::damage(const DrawList &previous, Rect clip, Renderer *renderer) const {
+    int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+    auto add = [&](Rect rect) {
+        if (rect.w <= 0 || rect.h <= 0) { return; }
+        x0 = std::min(x0, rect.x);
+        y0 = std::min(y0, rect.y);
+        x1 = std::max(x1, rect.x + rect.w);
+        y1 = std::max(y1, rect.y + rect.h);
+    };
+    auto skip = [&](const DrawList &list, Cursor &cursor, int count) {
+        for (int i = 0; i < count && cursor.command; i++) {
+            if (cursor.command->type != Type::SetClip) {
+                add(bounds(cursor.command, cursor.clip, renderer));
+            }
+            step(list, cursor);
+        }
+    };
+    Cursor current = Cursor{first(), clip};
+    Cursor old = Cursor{previous.first(), clip};
+    Cursor current_ahead[DAMAGE_LOOKAHEAD + 1];
+    Cursor old_ahead[DAMAGE_LOOKAHEAD + 1];
+    while (current.command || old.command) {
+        if (isSame(current, old)) {
+            step(*this, current);
+            step(previous, old);
+            continue;
+        }
+        current_ahead[0] = current;
+        old_ahead[0] = old;
+        for (int i = 1; i <= DAMAGE_LOOKAHEAD; i++) {
+            current_ahead[i] = current_ahead[i - 1];
+            step(*this, current_ahead[i]);
+            old_ahead[i] = old_ahead[i - 1];
+            step(previous, old_ahead[i]);
+        }
+        int skip_current = 1;
+        int skip_old = 1;
+        bool is_found = false;
+        for (int distance = 1; distance <= DAMAGE_LOOKAHEAD * 2 && !is_found; distance++) {
+            for (int i = std::max(0, distance - DAMAGE_LOOKAHEAD); i <= std::min(distance, DAMAGE_LOOKAHEAD); i++) {
+                if (isSame(current_ahead[i], old_ahead[distance - i])) {
+                    skip_current = i;
+                    skip_old = distance - i;
+                    is_found = true;
+                    break;
+                }
+            }
+        }
+        skip(*this, current, skip_current);
+        skip(previous, old, skip_old);
+    }
+    if (x0 > x1) { return Rect(); }
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+const DrawList::Command* DrawList::first() const {
+    return m_arena.size() ? (const Command*)m_arena.data() : nullptr;
+}
+
+const DrawList::Command* DrawList::next(const Command *command) const {
+    const unsigned char *next = (const unsigned char*)command + command->size;
+    return next < m_arena.data() + m_arena.size() ? (const Command*)next : nullptr;
+}
+
+bool DrawList::operator==(const DrawList &other) const {
+    return m_count == other.m_count &&
+           m_arena.size() == other.m_arena.size() &&
+           (m_arena.empty() || !memcmp(m_arena.data(), other.m_arena.data(), m_arena.size()));
+}
+
+bool DrawList::operator!=(const DrawList &other) const {
+    return !(*this == other);
+}
@@ -0,0 +1,135 @@
+#ifndef DRAW_LIST_HPP
+    #define DRAW_LIST_HPP
+
+    #include <vector>
+    #include <cstdint>
+
+    #include "../slice.hpp"
+
+    #include "../common/enums.hpp"
+    #include "../common/color.hpp"
+    #include "../common/rect.hpp"
+    #include "../common/size.hpp"
+    #include "../common/point.hpp"
+
+    #include "renderer.hpp"
+
+    /// A recorded sequence of drawing commands.
+    /// Commands are stored back to back in a single arena, each one starting
+    /// with a Command header that holds its type and total size so that the
+    /// list can be walked without knowing every command up front.
+    /// Lists hold no GL state, they can be recorded on any thread, compared
+    /// with the output of a previous frame and replayed into a Renderer later.
+    struct DrawList {
+        enum class Type : uint8_t {
+            FillRect,
+            FillRectWithGradient,
+            FillText,
+            DrawTexture,
+            SetClip
+        };
+
+        struct Command {
+            Type type;
+            uint32_t size;
+        };
+
+        struct FillRectCommand {
+            Command header;
+            Rect rect;
+            Color color;
+        };
+
+        struct FillRectWithGradientCommand {
+            Command header;
+            Rect rect;
+            Color from_color;
+            Color to_color;
+            Gradient orientation;
+        };
+
+        /// Followed by `length` bytes of text.
+        struct FillTextCommand {
+            Command header;
+            Font *font;
+            Point point;
+            Color color;
+            int tab_width;
+            int line_spacing;
+            bool is_multiline;
+            Renderer::Selection selection;
+            Color selection_color;
+            uint32_t length;
+
+            Slice<const char> text() const;
+        };
+
+        struct DrawTextureCommand {
+            Command header;
+            Point point;
+            Size size;
+            Texture *texture;
+            TextureCoordinates coords;
+            Color color;
+        };
+
+        struct SetClipCommand {
+            Command header;
+            Rect rect;
+        };
+
+        /// The most recently recorded clip.
+        Rect clip;
+
+        DrawList();
+        void clear();
+        bool empty() const;
+        size_t count() const;
+        /// Size of the arena in bytes.
+        size_t size() const;
+
+        void fillRect(Rect rect, Color color);
+        void fillRectWithGradient(Rect rect, Color from_color, Color to_color, Gradient orientation);
+        void fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, bool is_multiline, int line_spacing, Renderer::Selection selection, Color selection_color);
+        void drawTexture(Point point, Size size, Texture *texture, TextureCoordinates *coords, Color color);
+        void setClip(Rect rect);
+
+        /// Copies the commands of `other` onto the end of this list.
+        void append(const DrawList &other);
+
+        /// Moves every recorded primitive and clip by `offset`.
+        void translate(Point offset);
+
+        /// Submits the commands to `renderer`, moved by `offset`.
+        /// Long lists have their quads generated on the workers of the
+        /// renderer when it has any, see Renderer::setWorkerCount().
+        void replay(Renderer *renderer, Point offset = Point()) const;
+
+        /// Returns the bounding box of every pixel that could differ between
+        /// replaying `previous` and this list when both start out with `clip`.
+        /// Commands get compared in order, a command that differs from its
+        /// counterpart, or runs under a different clip, damages its bounds
+        /// in both lists. Commands added or removed in between are found by
+        /// looking ahead a few commands and only damage their own bounds.
+        /// An empty Rect means nothing changed.
+        Rect damage(const DrawList &previous, Rect clip, Renderer *renderer) const;
+
+        /// Returns the first command, iterate with next() until it returns nullptr.
+        const Command* first() const;
+        const Command* next(const Command *command) const;
+
+        /// Whether both lists hold exactly the same commands.
+        bool operator==(const DrawList &other) const;
+        bool operator!=(const DrawList &other) const;
+
+        private:
+            std::vector<unsigned char> m_arena;
+            size_t m_count = 0;
+
+            void* push(Type type, size_t size);
+            void replayParallel(Renderer *renderer, Point offset) const;
+            const Command* replayRects(Renderer *renderer, const Command *command, Point offset) const;
+            static Rect bounds(const Command *command, Rect clip, Renderer *renderer);
+            Command* at(size_t offset);
+    };
+#endif
@@ -7,19 +7,11 @@ DrawingContext::DrawingContext() {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-    unsigned int offset = 0;
-    unsigned int indexCount = MAX_BATCH_SIZE * QUAD_INDEX_COUNT;
-    for (unsigned int i = 0; i < indexCount; i += QUAD_INDEX_COUNT) {
-        indices[i + 0] = 0 + offset;
-        indices[i + 1] = 1 + offset;
-        indices[i + 2] = 2 + offset;
-        indices[i + 3] = 2 + offset;
-        indices[i + 4] = 3 + offset;
-        indices[i + 5] = 0 + offset;
-        offset += 4;
-    }
-
-    renderer = new Renderer(indices);
+    renderer = new Renderer();
+    atlas = new TextureAtlas(renderer->backend == Renderer::Backend::Array);
+    renderer->atlas = atlas;
+    text_runs = new TextRunCache();
+    renderer->text_runs = text_runs;
 
     default_light_style = {
         Style::Margin{
@@ -113,35 +105,62 @@ DrawingContext::DrawingContext() {
         Color("#ffffff"),
         Color("#dddddd")
     };
-    default_style = default_light_style;
+    m_default_style = default_light_style;
 }
 
 DrawingContext::~DrawingContext() {
     delete renderer;
-    delete default_font;
+    delete atlas;
+    delete text_runs;
 }
 
 void DrawingContext::fillRect(Rect rect, Color color) {
-    renderer->fillRect(rect, color);
+    if (recording) {
+        recording->fillRect(rect, color);
+    } else {
+        renderer->fillRect(rect, color);
+    }
 }
 
 void DrawingContext::fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation) {
-    renderer->fillRectWithGradient(rect, fromColor, toColor, orientation);
+    if (recording) {
+        recording->fillRectWithGradient(rect, fromColor, toColor, orientation);
+    } else {
+        renderer->fillRectWithGradient(rect, fromColor, toColor, orientation);
+    }
+}
+
+void DrawingContext::fillRects(Slice<const Rect> rects, Color color) {
+    if (recording) {
+        for (size_t i = 0; i < rects.length; i++) {
+            recording->fillRect(rects.data[i], color);
+        }
+    } else {
+        renderer->fillRects(rects.data, rects.length, color);
+    }
+}
+
+void DrawingContext::fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, bool is_multiline, int line_spacing, Renderer::Selection selection, Color selection_color) {
+    if (recording) {
+        recording->fillText(font, text, point, color, tab_width, is_multiline, line_spacing, selection, selection_color);
+    } else {
+        renderer->fillText(font, text, point, color, tab_width, is_multiline, line_spacing, selection, selection_color);
+    }
 }
 
 void DrawingContext::render() {
     renderer->render();
 }
 
-void DrawingContext::fillText(Font *font, std::string text, Point point, Color color, int tab_width, Renderer::Selection selection, Color selection_color) {
-    renderer->fillText(font ? font : default_font, Slice<const char>(text.c_str(), text.length()), point, color, tab_width, false, 0, selection, selection_color);
+void DrawingContext::fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, Renderer::Selection selection, Color selection_color) {
+    fillText(font ? font : default_font, text, point, color, tab_width, false, 0, selection, selection_color);
 }
 
-void DrawingContext::fillTextMultiline(Font *font, std::string text, Point point, Color color, int tab_width, int line_spacing, Renderer::Selection selection, Color selection_color) {
-    renderer->fillText(font ? font : default_font, Slice<const char>(text.c_str(), text.length()), point, color, tab_width, true, line_spacing, selection, selection_color);
+void DrawingContext::fillTextMultiline(Font *font, Slice<const char> text, Point point, Color color, int tab_width, int line_spacing, Renderer::Selection selection, Color selection_color) {
+    fillText(font ? font : default_font, text, point, color, tab_width, true, line_spacing, selection, selection_color);
 }
 
-void DrawingContext::fillTextAligned(Font *font, std::string text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color, int tab_width, Renderer::Selection selection, Color selection_color) {
+void DrawingContext::fillTextAligned(Font *font, Slice<const char> text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color, int tab_width, Renderer::Selection selection, Color selection_color) {
     Point pos = Point();
     Size text_size = measureText(font, text, tab_width);
     switch (h_align) {
@@ -177,7 +196,7 @@ void DrawingContext::fillTextAligned(Font *font, std::string text, HorizontalAli
     );
 }
 
-void DrawingContext::fillTextMultilineAligned(Font *font, std::string text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color, int tab_width, int line_spacing, Renderer::Selection selection, Color selection_color) {
+void DrawingContext::fillTextMultilineAligned(Font *font, Slice<const char> text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color, int tab_width, int line_spacing, Renderer::Selection selection, Color selection_color) {
     font = font ? font : default_font;
     Point pos = Point(rect.x, rect.y);
     Size text_size = measureTextMultiline(font, text, tab_width, line_spacing);
@@ -194,9 +213,10 @@ void DrawingContext::fillTextMultilineAligned(Font *font, std::string text, Hori
     }
 
     int line_width = 0;
-    const char *start = text.data();
+    const char *start = text.data;
     size_t count = 0;
-    for (char c : text) {
+    for (size_t i = 0; i < text.length; i++) {
+        char c = text.data[i];
         line_width += measureText(font, c, tab_width).w;
         count++;
         if (c == '\n') {
@@ -211,7 +231,7 @@ void DrawingContext::fillTextMultilineAligned(Font *font, std::string text, Hori
                     pos.x = rect.x + (rect.w * 0.5) - (line_width * 0.5);
                     break;
             }
-            renderer->fillText(font, Slice<const char>(start, count), pos, color, tab_width, false, 0, selection, selection_color);
+            fillText(font, Slice<const char>(start, count), pos, color, tab_width, false, 0, selection, selection_color);
             start += count;
             pos.y += font->max_height + line_spacing;
             pos.x = rect.x;
@@ -230,18 +250,18 @@ void DrawingContext::fillTextMultilineAligned(Font *font, std::string text, Hori
             pos.x = rect.x + (rect.w * 0.5) - (line_width * 0.5);
             break;
     }
-    renderer->fillText(font, Slice<const char>(start, count), pos, color, tab_width, false, 0, selection, selection_color);
+    fillText(font, Slice<const char>(start, count), pos, color, tab_width, false, 0, selection, selection_color);
 }
 
-Size DrawingContext::measureText(Font *font, std::string text, int tab_width) {
+Size DrawingContext::measureText(Font *font, Slice<const char> text, int tab_width) {
     return renderer->measureText(font ? font : default_font, text, tab_width);
 }
 
 Size DrawingContext::measureText(Font *font, char c, int tab_width) {
-    return renderer->measureText(font ? font : default_font, std::string(1, c), tab_width);
+    return renderer->measureText(font ? font : default_font, c, tab_width);
 }
 
-Size DrawingContext::measureTextMultiline(Font *font, std::string text, int tab_width, int line_spacing) {
+Size DrawingContext::measureTextMultiline(Font *font, Slice<const char> text, int tab_width, int line_spacing) {
     return renderer->measureText(font ? font : default_font, text, tab_width, true, line_spacing);
 }
 
@@ -326,30 +346,30 @@ Rect DrawingContext::drawBorder3D(Rect rect, int border_width, Color rect_color)
 
 void DrawingContext::drawBorder(Rect &rect, Style &style) {
     if (style.border.type != STYLE_NONE) {
-        const int border = style.border.type == STYLE_DEFAULT ? default_style.border.type : style.border.type;
+        const int border = style.border.type == STYLE_DEFAULT ? m_default_style.border.type : style.border.type;
         if (border & STYLE_TOP) {
-            const int size = style.border.top < 0 ? default_style.border.top : style.border.top;
-            const Color color = style.border.color_top.is_default == Color::IsDefault::Yes ? default_style.border.color_top : style.border.color_top;
+            const int size = style.border.top < 0 ? m_default_style.border.top : style.border.top;
+            const Color color = style.border.color_top.is_default == Color::IsDefault::Yes ? m_default_style.border.color_top : style.border.color_top;
             fillRect(Rect(rect.x, rect.y, rect.w, size), color);
             rect.y += size;
             rect.h -= size;
         }
         if (border & STYLE_BOTTOM) {
-            const int size = style.border.bottom < 0 ? default_style.border.bottom : style.border.bottom;
-            const Color color = style.border.color_bottom.is_default == Color::IsDefault::Yes ? default_style.border.color_bottom : style.border.color_bottom;
+            const int size = style.border.bottom < 0 ? m_default_style.border.bottom : style.border.bottom;
+            const Color color = style.border.color_bottom.is_default == Color::IsDefault::Yes ? m_default_style.border.color_bottom : style.border.color_bottom;
             rect.h -= size;
             fillRect(Rect(rect.x, rect.y + rect.h, rect.w, size), color);
         }
         if (border & STYLE_LEFT) {
-            const int size = style.border.left < 0 ? default_style.border.left : style.border.left;
-            const Color color = style.border.color_left.is_default == Color::IsDefault::Yes ? default_style.border.color_left : style.border.color_left;
+            const int size = style.border.left < 0 ? m_default_style.border.left : style.border.left;
+            const Color color = style.border.color_left.is_default == Color::IsDefault::Yes ? m_default_style.border.color_left : style.border.color_left;
             fillRect(Rect(rect.x, rect.y, size, rect.h), color);
             rect.x += size;
             rect.w -= size;
         }
         if (border & STYLE_RIGHT) {
-            const int size = style.border.right < 0 ? default_style.border.right : style.border.right;
-            const Color color = style.border.color_right.is_default == Color::IsDefault::Yes ? default_style.border.color_right : style.border.color_right;
+            const int size = style.border.right < 0 ? m_default_style.border.right : style.border.right;
+            const Color color = style.border.color_right.is_default == Color::IsDefault::Yes ? m_default_style.border.color_right : style.border.color_right;
             rect.w -= size;
             fillRect(Rect(rect.x + rect.w, rect.y, size, rect.h), color);
         }
@@ -358,23 +378,23 @@ void DrawingContext::drawBorder(Rect &rect, Style &style) {
 
 void DrawingContext::margin(Rect &rect, Style &style) {
     if (style.margin.type != STYLE_NONE) {
-        const int margin = style.margin.type == STYLE_DEFAULT ? default_style.margin.type : style.margin.type;
+        const int margin = style.margin.type == STYLE_DEFAULT ? m_default_style.margin.type : style.margin.type;
         if (margin & STYLE_TOP) {
-            const int size = style.margin.top < 0 ? default_style.margin.top : style.margin.top;
+            const int size = style.margin.top < 0 ? m_default_style.margin.top : style.margin.top;
             rect.y += size;
             rect.h -= size;
         }
         if (margin & STYLE_BOTTOM) {
-            const int size = style.margin.bottom < 0 ? default_style.margin.bottom : style.margin.bottom;
+            const int size = style.margin.bottom < 0 ? m_default_style.margin.bottom : style.margin.bottom;
             rect.h -= size;
         }
         if (margin & STYLE_LEFT) {
-            const int size = style.margin.left < 0 ? default_style.margin.left : style.margin.left;
+            const int size = style.margin.left < 0 ? m_default_style.margin.left : style.margin.left;
             rect.x += size;
             rect.w -= size;
         }
         if (margin & STYLE_RIGHT) {
-            const int size = style.margin.right < 0 ? default_style.margin.right : style.margin.right;
+            const int size = style.margin.right < 0 ? m_default_style.margin.right : style.margin.right;
             rect.w -= size;
         }
     }
@@ -382,23 +402,23 @@ void DrawingContext::margin(Rect &rect, Style &style) {
 
 void DrawingContext::padding(Rect &rect, Style &style) {
     if (style.padding.type != STYLE_NONE) {
-        const int padding = style.padding.type == STYLE_DEFAULT ? default_style.padding.type : style.padding.type;
+        const int padding = style.padding.type == STYLE_DEFAULT ? m_default_style.padding.type : style.padding.type;
         if (padding & STYLE_TOP) {
-            const int size = style.padding.top < 0 ? default_style.padding.top : style.padding.top;
+            const int size = style.padding.top < 0 ? m_default_style.padding.top : style.padding.top;
             rect.y += size;
             rect.h -= size;
         }
         if (padding & STYLE_BOTTOM) {
-            const int size = style.padding.bottom < 0 ? default_style.padding.bottom : style.padding.bottom;
+            const int size = style.padding.bottom < 0 ? m_default_style.padding.bottom : style.padding.bottom;
             rect.h -= size;
         }
         if (padding & STYLE_LEFT) {
-            const int size = style.padding.left < 0 ? default_style.padding.left : style.padding.left;
+            const int size = style.padding.left < 0 ? m_default_style.padding.left : style.padding.left;
             rect.x += size;
             rect.w -= size;
         }
         if (padding & STYLE_RIGHT) {
-            const int size = style.padding.right < 0 ? default_style.padding.right : style.padding.right;
+            const int size = style.padding.right < 0 ? m_default_style.padding.right : style.padding.right;
             rect.w -= size;
         }
     }
@@ -406,54 +426,54 @@ void DrawingContext::padding(Rect &rect, Style &style) {
 
 void DrawingContext::sizeHintMargin(Size &size, Style &style) {
     if (style.margin.type != STYLE_NONE) {
-        const int margin = style.margin.type == STYLE_DEFAULT ? default_style.margin.type : style.margin.type;
+        const int margin = style.margin.type == STYLE_DEFAULT ? m_default_style.margin.type : style.margin.type;
         if (margin & STYLE_TOP) {
-            size.h += style.margin.top < 0 ? default_style.margin.top : style.margin.top;
+            size.h += style.margin.top < 0 ? m_default_style.margin.top : style.margin.top;
         }
         if (margin & STYLE_BOTTOM) {
-            size.h += style.margin.bottom < 0 ? default_style.margin.bottom : style.margin.bottom;
+            size.h += style.margin.bottom < 0 ? m_default_style.margin.bottom : style.margin.bottom;
         }
         if (margin & STYLE_LEFT) {
-            size.w += style.margin.left < 0 ? default_style.margin.left : style.margin.left;
+            size.w += style.margin.left < 0 ? m_default_style.margin.left : style.margin.left;
         }
         if (margin & STYLE_RIGHT) {
-            size.w += style.margin.right < 0 ? default_style.margin.right : style.margin.right;
+            size.w += style.margin.right < 0 ? m_default_style.margin.right : style.margin.right;
         }
     }
 }
 
 void DrawingContext::sizeHintBorder(Size &size, Style &style) {
     if (style.border.type != STYLE_NONE) {
-        const int border = style.border.type == STYLE_DEFAULT ? default_style.border.type : style.border.type;
+        const int border = style.border.type == STYLE_DEFAULT ? m_default_style.border.type : style.border.type;
         if (border & STYLE_TOP) {
-            size.h += style.border.top < 0 ? default_style.border.top : style.border.top;
+            size.h += style.border.top < 0 ? m_default_style.border.top : style.border.top;
         }
         if (border & STYLE_BOTTOM) {
-            size.h += style.border.bottom < 0 ? default_style.border.bottom : style.border.bottom;
+            size.h += style.border.bottom < 0 ? m_default_style.border.bottom : style.border.bottom;
         }
         if (border & STYLE_LEFT) {
-            size.w += style.border.left < 0 ? default_style.border.left : style.border.left;
+            size.w += style.border.left < 0 ? m_default_style.border.left : style.border.left;
         }
         if (border & STYLE_RIGHT) {
-            size.w += style.border.right < 0 ? default_style.border.right : style.border.right;
+            size.w += style.border.right < 0 ? m_default_style.border.right : style.border.right;
         }
     }
 }
 
 void DrawingContext::sizeHintPadding(Size &size, Style &style) {
     if (style.padding.type != STYLE_NONE) {
-        const int padding = style.padding.type == STYLE_DEFAULT ? default_style.padding.type : style.padding.type;
+        const int padding = style.padding.type == STYLE_DEFAULT ? m_default_style.padding.type : style.padding.type;
         if (padding & STYLE_TOP) {
-            size.h += style.padding.top < 0 ? default_style.padding.top : style.padding.top;
+            size.h += style.padding.top < 0 ? m_default_style.padding.top : style.padding.top;
         }
         if (padding & STYLE_BOTTOM) {
-            size.h += style.padding.bottom < 0 ? default_style.padding.bottom : style.padding.bottom;
+            size.h += style.padding.bottom < 0 ? m_default_style.padding.bottom : style.padding.bottom;
         }
         if (padding & STYLE_LEFT) {
-            size.w += style.padding.left < 0 ? default_style.padding.left : style.padding.left;
+            size.w += style.padding.left < 0 ? m_default_style.padding.left : style.padding.left;
         }
         if (padding & STYLE_RIGHT) {
-            size.w += style.padding.right < 0 ? default_style.padding.right : style.padding.right;
+            size.w += style.padding.right < 0 ? m_default_style.padding.right : style.padding.right;
         }
     }
 }
@@ -468,7 +488,11 @@ void DrawingContext::swap_buffer(SDL_Window *win) {
 }
 
 void DrawingContext::drawTexture(Point point, Size size, Texture *texture, TextureCoordinates *coords, Color color) {
-    renderer->drawTexture(point, size, texture, coords, color);
+    if (recording) {
+        recording->drawTexture(point, size, texture, coords, color);
+    } else {
+        renderer->drawTexture(point, size, texture, coords, color);
+    }
 }
 
 void DrawingContext::drawTextureAligned(Rect rect, Size size, Texture *texture, TextureCoordinates *coords, HorizontalAlignment h_align, VerticalAlignment v_align, Color color) {
@@ -509,63 +533,97 @@ void DrawingContext::drawPoint(Point point, Color color) {
 }
 
 void DrawingContext::setClip(Rect rect) {
-    this->renderer->clip_rect = rect;
+    if (recording) {
+        recording->setClip(rect);
+    } else {
+        this->renderer->setClip(rect);
+    }
 }
 
 Rect DrawingContext::clip() {
+    if (recording) { return recording->clip; }
     return this->renderer->clip_rect;
 }
 
+void DrawingContext::beginRecording(DrawList *list) {
+    list->clear();
+    list->clip = clip();
+    recording = list;
+}
+
+DrawList* DrawingContext::endRecording() {
+    DrawList *list = recording;
+    recording = nullptr;
+    return list;
+}
+
+const Style& DrawingContext::defaultStyle() {
+    return m_default_style;
+}
+
+void DrawingContext::setDefaultStyle(Style style) {
+    m_default_style = style;
+    generation++;
+}
+
+void DrawingContext::replay(const DrawList &list) {
+    if (recording) {
+        recording->append(list);
+    } else {
+        list.replay(this->renderer);
+    }
+}
+
 Color DrawingContext::windowBackground(Style &style) {
-    return style.window_background ? this->default_style.window_background : style.window_background;
+    return style.window_background ? this->m_default_style.window_background : style.window_background;
 }
 
 Color DrawingContext::widgetBackground(Style &style) {
-    return style.widget_background ? this->default_style.widget_background : style.widget_background;
+    return style.widget_background ? this->m_default_style.widget_background : style.widget_background;
 }
 
 Color DrawingContext::accentWidgetBackground(Style &style) {
-    return style.accent_widget_background ? this->default_style.accent_widget_background : style.accent_widget_background;
+    return style.accent_widget_background ? this->m_default_style.accent_widget_background : style.accent_widget_background;
 }
 
 Color DrawingContext::hoveredBackground(Style &style) {
-    return style.hovered_background ? this->default_style.hovered_background : style.hovered_background;
+    return style.hovered_background ? this->m_default_style.hovered_background : style.hovered_background;
 }
 
 Color DrawingContext::pressedBackground(Style &style) {
-    return style.pressed_background ? this->default_style.pressed_background : style.pressed_background;
+    return style.pressed_background ? this->m_default_style.pressed_background : style.pressed_background;
 }
 
 Color DrawingContext::accentHoveredBackground(Style &style) {
-    return style.accent_hovered_background ? this->default_style.accent_hovered_background : style.accent_hovered_background;
+    return style.accent_hovered_background ? this->m_default_style.accent_hovered_background : style.accent_hovered_background;
 }
 
 Color DrawingContext::accentPressedBackground(Style &style) {
-    return style.accent_pressed_background ? this->default_style.accent_pressed_background : style.accent_pressed_background;
+    return style.accent_pressed_background ? this->m_default_style.accent_pressed_background : style.accent_pressed_background;
 }
 
 Color DrawingContext::textForeground(Style &style) {
-    return style.text_foreground ? this->default_style.text_foreground : style.text_foreground;
+    return style.text_foreground ? this->m_default_style.text_foreground : style.text_foreground;
 }
 
 Color DrawingContext::textBackground(Style &style) {
-    return style.text_background ? this->default_style.text_background : style.text_background;
+    return style.text_background ? this->m_default_style.text_background : style.text_background;
 }
 
 Color DrawingContext::textSelected(Style &style) {
-    return style.text_selected ? this->default_style.text_selected : style.text_selected;
+    return style.text_selected ? this->m_default_style.text_selected : style.text_selected;
 }
 
 Color DrawingContext::textDisabled(Style &style) {
-    return style.text_disabled ? this->default_style.text_disabled : style.text_disabled;
+    return style.text_disabled ? this->m_default_style.text_disabled : style.text_disabled;
 }
 
 Color DrawingContext::iconForeground(Style &style) {
-    return style.icon_foreground ? this->default_style.icon_foreground : style.icon_foreground;
+    return style.icon_foreground ? this->m_default_style.icon_foreground : style.icon_foreground;
 }
 
 Color DrawingContext::borderBackground(Style &style) {
-    return style.border_background ? this->default_style.border_background : style.border_background;
+    return style.border_background ? this->m_default_style.border_background : style.border_background;
 }
 
 Color DrawingContext::getColor(Point point) {
@@ -16,7 +16,11 @@
     #include "shader.hpp"
     #include "batch.hpp"
     #include "renderer.hpp"
+    #include "atlas.hpp"
+    #include "draw_list.hpp"
     #include "font.hpp"
+    #include "font_cache.hpp"
+    #include "text_run_cache.hpp"
 
     struct DrawingContext {
         // TODO dc will need to be modified so that
@@ -24,24 +28,32 @@
         // renderer instances that refer to different windows/glcontexts
         // finally it will need to be made static and initialized before
         // all other imports so we could access it anywhere
-        unsigned int indices[MAX_BATCH_SIZE * QUAD_INDEX_COUNT];
         Renderer *renderer = nullptr;
+        TextureAtlas *atlas = nullptr;
+        /// Layouts of recently drawn and measured text, shared with the renderer.
+        TextRunCache *text_runs = nullptr;
+        /// While set every primitive gets recorded into this list
+        /// instead of going to the renderer.
+        DrawList *recording = nullptr;
         Font *default_font = nullptr;
         Style default_light_style;
         Style default_dark_style;
-        Style default_style;
+        /// Bumped whenever something that every Widget draws with changes,
+        /// which drops all of the cached Widget geometry.
+        uint64_t generation = 0;
 
         DrawingContext();
         ~DrawingContext();
         void fillRect(Rect rect, Color color);
         void fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation);
-        void fillText(Font *font, std::string text, Point point, Color color = COLOR_BLACK, int tab_width = 4, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
-        void fillTextMultiline(Font *font, std::string text, Point point, Color color = COLOR_BLACK, int tab_width = 4, int line_spacing = 5, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
-        void fillTextAligned(Font *font, std::string text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color = COLOR_BLACK, int tab_width = 4, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
-        void fillTextMultilineAligned(Font *font, std::string text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color = COLOR_BLACK, int tab_width = 4, int line_spacing = 5, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
-        Size measureText(Font *font, std::string text, int tab_width = 4);
+        void fillRects(Slice<const Rect> rects, Color color);
+        void fillText(Font *font, Slice<const char> text, Point point, Color color = COLOR_BLACK, int tab_width = 4, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
+        void fillTextMultiline(Font *font, Slice<const char> text, Point point, Color color = COLOR_BLACK, int tab_width = 4, int line_spacing = 5, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
+        void fillTextAligned(Font *font, Slice<const char> text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color = COLOR_BLACK, int tab_width = 4, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
+        void fillTextMultilineAligned(Font *font, Slice<const char> text, HorizontalAlignment h_align, VerticalAlignment v_align, Rect rect, int padding, Color color = COLOR_BLACK, int tab_width = 4, int line_spacing = 5, Renderer::Selection selection = Renderer::Selection(), Color selection_color = COLOR_BLACK);
+        Size measureText(Font *font, Slice<const char> text, int tab_width = 4);
         Size measureText(Font *font, char c, int tab_width = 4);
-        Size measureTextMultiline(Font *font, std::string text, int tab_width = 4, int line_spacing = 5);
+        Size measureTextMultiline(Font *font, Slice<const char> text, int tab_width = 4, int line_spacing = 5);
         void render();
         Rect drawBorder3D(Rect rect, int border_width, Color rect_color);
         void drawBorder(Rect &rect, Style &style);
@@ -57,6 +69,17 @@
         void swap_buffer(SDL_Window *win);
         void setClip(Rect rect);
         Rect clip();
+        /// Starts recording into `list` which gets cleared first.
+        void beginRecording(DrawList *list);
+        DrawList* endRecording();
+        /// Submits a previously recorded list, or appends it to the
+        /// list currently being recorded.
+        void replay(const DrawList &list);
+        /// The style Widgets fall back to for anything their own style
+        /// leaves unset. Setting it drops all of the cached Widget geometry.
+        const Style& defaultStyle();
+        void setDefaultStyle(Style style);
+        void fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, bool is_multiline, int line_spacing, Renderer::Selection selection, Color selection_color);
 
         // TODO these should probably move to widget
         // this way the user could easily query the color of the widget
@@ -77,5 +100,8 @@
         Color borderBackground(Style &style);
 
         Color getColor(Point point);
+
+        private:
+            Style m_default_style;
     };
 #endif
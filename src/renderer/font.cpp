@@ -1,88 +1,411 @@
+#include <SDL.h>
+#include <cmath>
+#include <algorithm>
+
 #include "font.hpp"
+#include "font_cache.hpp"
+#include "prebaked_font.hpp"
+
+#include FT_ADVANCES_H
+
+uint64_t Font::serials = 0;
 
 Font::Font(std::string file_path, unsigned int pixel_size, Font::Type type)
-: file_path{file_path}, pixel_size{pixel_size}, type{type} {
-    FT_Library ft;
-    if (FT_Init_FreeType(&ft)) {
-        error("FAILED_TO_INITIALISE_FREETYPE");
-    }
-    FT_Face face;
-    if (FT_New_Face(ft, file_path.c_str(), 0, &face)) {
+: Font(FontCache::get()->face(file_path), file_path, pixel_size, type) {}
+
+Font::Font(const unsigned char *data, signed long length, unsigned int pixel_size, Font::Type type)
+: Font(FontCache::get()->face(data, length), ":memory:", pixel_size, type) {}
+
+Font::Font(FT_Face face, std::string file_path, unsigned int pixel_size, Font::Type type, Font::Rendering rendering, bool is_deferred)
+: file_path{file_path}, pixel_size{pixel_size}, type{type}, rendering{rendering}, atlas{FontCache::get()->atlas()}, m_face{face} {
+    uint64_t start = SDL_GetPerformanceCounter();
+    if (FT_New_Size(m_face, &m_size)) {
         error("FAILED_TO_LOAD_FONT",  file_path);
     }
-    load(face);
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
+    if (is_deferred) {
+        estimate();
+    } else {
+        load();
+    }
+    stats.load_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
 }
 
-Font::Font(const unsigned char *data, signed long length, unsigned int pixel_size, Font::Type type)
-: file_path{":memory:"}, pixel_size{pixel_size}, type{type} {
-    FT_Library ft;
-    if (FT_Init_FreeType(&ft)) {
-        error("FAILED_TO_INITIALISE_FREETYPE");
-    }
-    FT_Face face;
-    if (FT_New_Memory_Face(ft, data, length, 0, &face)) {
+// Sizing the face is the only FreeType work, glyphs beyond ASCII still get
+// rasterized when first used.
+Font::Font(FT_Face face, std::string file_path, Font::Type type, const PrebakedFont &baked)
+: file_path{file_path}, pixel_size{baked.pixel_size}, type{type}, atlas{FontCache::get()->atlas()}, m_face{face} {
+    uint64_t start = SDL_GetPerformanceCounter();
+    if (FT_New_Size(m_face, &m_size)) {
         error("FAILED_TO_LOAD_FONT",  file_path);
     }
-    load(face);
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
+    FT_Activate_Size(m_size);
+    FT_Set_Pixel_Sizes(m_face, 0, pixel_size);
+    Sheet sheet;
+    sheet.cap_height = baked.cap_height;
+    sheet.width = baked.width;
+    sheet.height = baked.height;
+    sheet.pixels.assign(baked.pixels, baked.pixels + (size_t)baked.width * baked.height);
+    for (uint32_t c = 32; c < 128; c++) {
+        const PrebakedFont::Glyph &glyph = baked.glyphs[c - 32];
+        sheet.glyphs[c] = Glyph{glyph.advance, glyph.offset_x, glyph.offset_y, glyph.width, glyph.height, 0, 0, 0, 0, 0, 0};
+        sheet.x[c] = glyph.x;
+        sheet.y[c] = glyph.y;
+        sheet.bitmap[c] = sheet.bitmaps.size();
+        for (int row = 0; row < glyph.height; row++) {
+            const unsigned char *line = baked.pixels + (glyph.y + row) * baked.width + glyph.x;
+            sheet.bitmaps.insert(sheet.bitmaps.end(), line, line + glyph.width);
+        }
+    }
+    addSheet(sheet);
+    stats.bitmap_bytes = m_bitmaps.size();
+    stats.load_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+// Only scales the metrics of the ASCII glyphs, which the source keeps pinned.
+Font::Font(Font *source, unsigned int pixel_size)
+: file_path{source->file_path}, pixel_size{pixel_size}, type{source->type}, rendering{Rendering::DistanceField}, atlas{source->atlas},
+  m_source{source}, m_scale{pixel_size / (float)source->pixel_size} {
+    uint64_t start = SDL_GetPerformanceCounter();
+    max_height = std::ceil(source->max_height * m_scale);
+    for (uint32_t c = 32; c < 128; c++) {
+        setMetrics(c, glyph(c));
+    }
+    stats.load_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+static uint16_t normalizeToShort(float value) {
+    if (value <= 0.0f) { return 0; }
+    if (value >= 1.0f) { return UINT16_MAX; }
+    return (uint16_t)(value * UINT16_MAX + 0.5f);
 }
 
 Font::~Font() {
-    glDeleteTextures(1, &atlas_ID);
+    for (uint16_t page : m_pinned) {
+        atlas->unpin(page);
+    }
+    if (m_size) { FT_Done_Size(m_size); }
 }
 
-void Font::load(FT_Face face) {
-    FT_Set_Pixel_Sizes(face, 0, pixel_size);
+// Only ASCII gets rasterized up front, everything else waits for glyph().
+void Font::load() {
+    FT_Activate_Size(m_size);
+    FT_Set_Pixel_Sizes(m_face, 0, pixel_size);
 
-    FT_GlyphSlot g = face->glyph;
-    for (GLubyte c = 32; c < 128; c++)   {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+    if (FT_Load_Char(m_face, 'H', FT_LOAD_RENDER)) {
+        error("FAILED_TO_LOAD_CHAR", "H");
+    }
+    m_cap_height = m_face->glyph->bitmap_top;
+
+    for (uint32_t c = 32; c < 128; c++) {
+        Entry entry;
+        if (!rasterize(c, entry)) {
             error("FAILED_TO_LOAD_CHAR",  std::string(1, c));
         }
-        atlas_width += g->bitmap.width;
-        if (g->bitmap.rows > atlas_height) {
-            atlas_height = g->bitmap.rows;
+        upload(entry);
+        addAscii(c, entry);
+    }
+}
+
+// Advances of the unhinted outlines and the pixel size as the line height,
+// which mostly match what rasterizing comes up with and need no glyph
+// loaded. The cap height is only needed by glyphs rasterized before the
+// sheet arrives.
+void Font::estimate() {
+    FT_Activate_Size(m_size);
+    FT_Set_Pixel_Sizes(m_face, 0, pixel_size);
+    for (uint32_t c = 32; c < 128; c++) {
+        FT_Fixed advance = 0;
+        FT_Get_Advance(m_face, FT_Get_Char_Index(m_face, c), FT_LOAD_NO_HINTING, &advance);
+        metrics.advance[c] = (advance + 0x8000) >> 16;
+    }
+    max_height = pixel_size;
+    m_cap_height = (m_face->size->metrics.ascender + 63) >> 6;
+    is_ready = false;
+}
+
+void Font::finishLoading(Sheet &sheet) {
+    uint64_t start = SDL_GetPerformanceCounter();
+    if (!sheet.is_loaded) {
+        error("FAILED_TO_LOAD_FONT",  file_path);
+    }
+    addSheet(sheet);
+    stats.rasterized += 96;
+    stats.bitmap_bytes = m_bitmaps.size();
+    stats.background_ms = sheet.rasterize_ms;
+    stats.load_ms += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    is_ready = true;
+    // Runs laid out with the estimates hold no glyphs.
+    atlas->generation++;
+}
+
+void Font::addSheet(Sheet &sheet) {
+    m_cap_height = sheet.cap_height;
+    uint16_t page;
+    int x, y;
+    bool is_packed = sheet.width && sheet.height && atlas->add(sheet.width, sheet.height, sheet.pixels.data(), page, x, y);
+    size_t offset = m_bitmaps.size();
+    m_bitmaps.insert(m_bitmaps.end(), sheet.bitmaps.begin(), sheet.bitmaps.end());
+    max_height = 0;
+    for (uint32_t c = 32; c < 128; c++) {
+        Entry entry = Entry{sheet.glyphs[c], offset + sheet.bitmap[c], false, 0};
+        // Sheets too big for a page get their glyphs packed one by one.
+        if (!is_packed) {
+            upload(entry);
+        } else if (entry.glyph.width && entry.glyph.height) {
+            place(entry, page, x + sheet.x[c], y + sheet.y[c]);
         }
+        addAscii(c, entry);
     }
-    glActiveTexture(GL_TEXTURE0);
-    glGenTextures(1, &atlas_ID);
-    glBindTexture(GL_TEXTURE_2D, atlas_ID);
-    glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        GL_RED,
-        atlas_width,
-        atlas_height,
-        0,
-        GL_RED,
-        GL_UNSIGNED_BYTE,
-        NULL
-    );
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    int x = 0;
-    for (GLubyte c = 32; c < 128; c++)   {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-            error("FAILED_TO_LOAD_CHAR",  std::string(1, c));
+}
+
+void Font::addAscii(uint32_t c, const Entry &entry) {
+    const Glyph &glyph = (m_glyphs[c] = entry).glyph;
+    setMetrics(c, glyph);
+    // Distance fields are padded by the spread, which isn't part of the line.
+    int height = rendering == Rendering::DistanceField ? glyph.height - FONT_DISTANCE_FIELD_SPREAD * 2 : glyph.height;
+    if (height > (int)max_height) {
+        max_height = height;
+    }
+    if (glyph.texture && std::find(m_pinned.begin(), m_pinned.end(), glyph.page) == m_pinned.end()) {
+        atlas->pin(glyph.page);
+        m_pinned.push_back(glyph.page);
+    }
+}
+
+void Font::setMetrics(uint32_t c, const Glyph &glyph) {
+    metrics.advance[c] = glyph.advance;
+    metrics.offset_x[c] = glyph.offset_x;
+    metrics.offset_y[c] = glyph.offset_y;
+    metrics.width[c] = glyph.width;
+    metrics.height[c] = glyph.height;
+    metrics.uv_top_left[c] = glyph.uv_top_left;
+    metrics.uv_bottom_left[c] = glyph.uv_bottom_left;
+    metrics.uv_bottom_right[c] = glyph.uv_bottom_right;
+    metrics.uv_top_right[c] = glyph.uv_top_right;
+    metrics.texture[c] = glyph.texture;
+}
+
+const Font::Glyph& Font::glyph(uint32_t codepoint) {
+    if (m_source) {
+        return scaledGlyph(codepoint);
+    }
+    auto it = m_glyphs.find(codepoint);
+    if (it == m_glyphs.end()) {
+        Entry entry;
+        if (!rasterize(codepoint, entry)) {
+            entry = Entry{Glyph{}, 0, false, 0};
         }
-        glTexSubImage2D(GL_TEXTURE_2D, 0, x, 0, g->bitmap.width, g->bitmap.rows, GL_RED, GL_UNSIGNED_BYTE, g->bitmap.buffer);
-        Font::Character character = {
-            Point(g->bitmap_left, g->bitmap_top),
-            Size(g->bitmap.width, g->bitmap.rows),
-            g->advance.x >> 6,
-            x / (float)atlas_width
-        };
-        characters.insert(std::pair<char, Font::Character>(c, character));
-        x += g->bitmap.width;
-        if (g->bitmap.rows > max_height) {
-            max_height = g->bitmap.rows;
+        it = m_glyphs.insert(std::make_pair(codepoint, entry)).first;
+    }
+    Entry &entry = it->second;
+    if (!isPacked(entry) && entry.glyph.width && entry.glyph.height) {
+        // Either new or its page got evicted, in which case the bitmap is still around.
+        if (entry.glyph.texture) { stats.repacked++; }
+        upload(entry);
+    }
+    const Glyph &glyph = entry.glyph;
+    if (entry.is_packed) {
+        atlas->use(glyph.page);
+    }
+    return glyph;
+}
+
+// The scaled copy is only written when the glyph of the source moved,
+// same as glyph() it stays untouched once the text has been prepared.
+const Font::Glyph& Font::scaledGlyph(uint32_t codepoint) {
+    const Glyph &source = m_source->glyph(codepoint);
+    auto it = m_glyphs.find(codepoint);
+    if (it == m_glyphs.end()) {
+        it = m_glyphs.insert(std::make_pair(codepoint, Entry{Glyph{}, 0, false, 0})).first;
+    }
+    Entry &entry = it->second;
+    uint64_t epoch = source.texture ? atlas->pages[source.page].epoch : 0;
+    if (entry.is_packed && entry.glyph.texture == source.texture && entry.glyph.page == source.page && entry.epoch == epoch) {
+        return entry.glyph;
+    }
+    // Edges get rounded rather than sizes so that glyphs keep their place.
+    Glyph &glyph = entry.glyph;
+    glyph = source;
+    int x0 = std::lround(source.offset_x * m_scale);
+    int y0 = std::lround(source.offset_y * m_scale);
+    glyph.advance = std::lround(source.advance * m_scale);
+    glyph.offset_x = x0;
+    glyph.offset_y = y0;
+    glyph.width = std::lround((source.offset_x + source.width) * m_scale) - x0;
+    glyph.height = std::lround((source.offset_y + source.height) * m_scale) - y0;
+    entry.is_packed = true;
+    entry.epoch = epoch;
+    return glyph;
+}
+
+void Font::prepare(Slice<const char> text) {
+    size_t i = 0;
+    while (i < text.length) {
+        if ((unsigned char)text.data[i] < 128) {
+            i++;
+        } else {
+            glyph(decode(text, i));
         }
     }
 }
+
+uint32_t Font::decode(Slice<const char> text, size_t &i) {
+    const unsigned char *bytes = (const unsigned char*)text.data;
+    unsigned char lead = bytes[i];
+    size_t length;
+    uint32_t codepoint;
+    if (lead < 0x80) {
+        i++;
+        return lead;
+    } else if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = lead & 0x07;
+    } else {
+        i++;
+        return 0xFFFD;
+    }
+    if (i + length > text.length) {
+        i++;
+        return 0xFFFD;
+    }
+    for (size_t k = 1; k < length; k++) {
+        if ((bytes[i + k] & 0xC0) != 0x80) {
+            i++;
+            return 0xFFFD;
+        }
+        codepoint = codepoint << 6 | (bytes[i + k] & 0x3F);
+    }
+    // Overlong encodings, surrogates and values past the last codepoint.
+    const uint32_t minimum[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (codepoint < minimum[length] || (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+        i++;
+        return 0xFFFD;
+    }
+    i += length;
+    return codepoint;
+}
+
+// Renders the glyph and keeps its bitmap, the glyph still has to be uploaded.
+bool Font::rasterize(uint32_t codepoint, Entry &entry) {
+    FT_Activate_Size(m_size);
+    entry = Entry{Glyph{}, m_bitmaps.size(), false, 0};
+    if (!rasterize(m_face, rendering, m_cap_height, codepoint, entry.glyph, m_bitmaps)) {
+        return false;
+    }
+    stats.rasterized++;
+    stats.bitmap_bytes = m_bitmaps.size();
+    return true;
+}
+
+bool Font::rasterize(FT_Face face, Rendering rendering, int cap_height, uint32_t codepoint, Glyph &glyph, std::vector<unsigned char> &bitmaps) {
+    // Hinting is meant for the rasterized size, distance fields get scaled.
+    // Turning the rendered bitmap into distances is an order of magnitude
+    // faster than computing them from the outline.
+    if (rendering == Rendering::DistanceField) {
+        if (FT_Load_Char(face, codepoint, FT_LOAD_RENDER | FT_LOAD_NO_HINTING) || FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF)) {
+            return false;
+        }
+    } else if (FT_Load_Char(face, codepoint, FT_LOAD_RENDER)) {
+        return false;
+    }
+    FT_GlyphSlot g = face->glyph;
+    glyph = Glyph{};
+    glyph.advance = g->advance.x >> 6;
+    glyph.offset_x = g->bitmap_left;
+    glyph.offset_y = cap_height - g->bitmap_top;
+    glyph.width = g->bitmap.width;
+    glyph.height = g->bitmap.rows;
+    for (unsigned int row = 0; row < g->bitmap.rows; row++) {
+        const unsigned char *line = g->bitmap.buffer + row * g->bitmap.pitch;
+        bitmaps.insert(bitmaps.end(), line, line + g->bitmap.width);
+    }
+    return true;
+}
+
+// Same shelves with a pixel between glyphs as the atlas used to pack with.
+void Font::rasterizeSheet(FT_Face face, int max_width, Sheet &sheet) {
+    uint64_t start = SDL_GetPerformanceCounter();
+    if (FT_Load_Char(face, 'H', FT_LOAD_RENDER)) {
+        return;
+    }
+    sheet.cap_height = face->glyph->bitmap_top;
+    int shelf_x = 0;
+    int shelf_y = 0;
+    int shelf_height = 0;
+    for (uint32_t c = 32; c < 128; c++) {
+        sheet.bitmap[c] = sheet.bitmaps.size();
+        Glyph &glyph = sheet.glyphs[c];
+        if (!rasterize(face, Rendering::Bitmap, sheet.cap_height, c, glyph, sheet.bitmaps)) {
+            return;
+        }
+        if (shelf_x + glyph.width > max_width) {
+            shelf_y += shelf_height;
+            shelf_x = 0;
+            shelf_height = 0;
+        }
+        sheet.x[c] = shelf_x;
+        sheet.y[c] = shelf_y;
+        shelf_x += glyph.width + 1;
+        if (glyph.height + 1 > shelf_height) {
+            shelf_height = glyph.height + 1;
+        }
+        if (shelf_x > sheet.width) {
+            sheet.width = shelf_x;
+        }
+    }
+    sheet.height = shelf_y + shelf_height;
+    sheet.pixels.resize((size_t)sheet.width * sheet.height);
+    for (uint32_t c = 32; c < 128; c++) {
+        const Glyph &glyph = sheet.glyphs[c];
+        for (int row = 0; row < glyph.height; row++) {
+            const unsigned char *line = sheet.bitmaps.data() + sheet.bitmap[c] + row * glyph.width;
+            std::copy(line, line + glyph.width, sheet.pixels.begin() + (sheet.y[c] + row) * sheet.width + sheet.x[c]);
+        }
+    }
+    sheet.rasterize_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    sheet.is_loaded = true;
+}
+
+// Packs the kept bitmap into the atlas, glyphs too big for a page stay without one.
+void Font::upload(Entry &entry) {
+    Glyph &glyph = entry.glyph;
+    int w = glyph.width;
+    int h = glyph.height;
+    uint16_t page;
+    int x, y;
+    if (!w || !h || !atlas->add(w, h, m_bitmaps.data() + entry.bitmap, page, x, y)) {
+        glyph.width = 0;
+        glyph.height = 0;
+        return;
+    }
+    place(entry, page, x, y);
+}
+
+void Font::place(Entry &entry, uint16_t page, int x, int y) {
+    Glyph &glyph = entry.glyph;
+    int w = glyph.width;
+    int h = glyph.height;
+    int page_size = atlas->page_size;
+    uint32_t u0 = normalizeToShort(x / (float)page_size);
+    uint32_t u1 = normalizeToShort((x + w) / (float)page_size);
+    uint32_t v0 = normalizeToShort(y / (float)page_size);
+    uint32_t v1 = normalizeToShort((y + h) / (float)page_size);
+    glyph.uv_top_left = u0 | v1 << 16;
+    glyph.uv_bottom_left = u0 | v0 << 16;
+    glyph.uv_bottom_right = u1 | v0 << 16;
+    glyph.uv_top_right = u1 | v1 << 16;
+    glyph.texture = atlas->pages[page].ID;
+    glyph.page = page;
+    entry.is_packed = true;
+    entry.epoch = atlas->pages[page].epoch;
+}
+
+bool Font::isPacked(const Entry &entry) {
+    return entry.is_packed && atlas->pages[entry.glyph.page].epoch == entry.epoch;
+}
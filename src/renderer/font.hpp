@@ -1,11 +1,16 @@
 #ifndef FONT_HPP
     #define FONT_HPP
 
-    #include <map>
     #include <string>
+    #include <vector>
+    #include <cstdint>
+    #include <unordered_map>
 
     #include <ft2build.h>
     #include FT_FREETYPE_H
+    #include FT_SIZES_H
+
+    #include "../slice.hpp"
 
     #include "../common/color.hpp"
     #include "../common/rect.hpp"
@@ -13,9 +18,17 @@
     #include "../common/point.hpp"
 
     #include "glad.h"
+
+    struct PrebakedFont;
     #include "shader.hpp"
     #include "batch.hpp"
     #include "texture.hpp"
+    #include "glyph_atlas.hpp"
+
+    // Distance fields get rasterized at this size, other sizes are scaled from it.
+    #define FONT_DISTANCE_FIELD_SIZE 48
+    // Pixels the distance field reaches past the outline on each side.
+    #define FONT_DISTANCE_FIELD_SPREAD 8
 
     struct Font {
         enum class Type {
@@ -24,28 +37,192 @@
             Mono,
         };
 
-        struct Character {
-            Point bearing;
-            Size size;
-            long int advance;
-            float texture_x;
+        /// `Bitmap` rasterizes coverage at the pixel size of the font.
+        /// `DistanceField` rasterizes signed distance fields once per face
+        /// and draws every size from them, the shader turns distances back
+        /// into coverage. It trades the hinted look of small text for sizes
+        /// that cost no rasterization, which is what zooming needs.
+        enum class Rendering {
+            Bitmap,
+            DistanceField,
+        };
+
+        /// A glyph as it is laid out, the same values Metrics holds for ASCII.
+        struct Glyph {
+            int32_t advance;
+            int32_t offset_x;
+            int32_t offset_y;
+            int32_t width;
+            int32_t height;
+            uint32_t uv_top_left;
+            uint32_t uv_bottom_left;
+            uint32_t uv_bottom_right;
+            uint32_t uv_top_right;
+            /// The texture of the atlas page the glyph was packed into.
+            unsigned int texture;
+            uint16_t page;
+        };
+
+        /// The glyphs of ASCII laid out flat and indexed by the value of
+        /// a byte, so that the common case of text needs no lookups and can
+        /// be laid out several glyphs at a time. The ASCII glyphs are packed
+        /// when the font gets loaded and their pages are pinned in the atlas.
+        /// Bytes that are not ASCII characters and characters without
+        /// a glyph are all zeros.
+        struct Metrics {
+            int32_t advance[256];
+            /// Position of the glyph relative to the pen, with the pen
+            /// at the top of the line.
+            int32_t offset_x[256];
+            int32_t offset_y[256];
+            int32_t width[256];
+            int32_t height[256];
+            /// Normalized texture coordinates of each corner,
+            /// packed the way Renderer::Vertex stores them, u | v << 16.
+            uint32_t uv_top_left[256];
+            uint32_t uv_bottom_left[256];
+            uint32_t uv_bottom_right[256];
+            uint32_t uv_top_right[256];
+            /// The texture of the page each glyph was packed into.
+            unsigned int texture[256];
+        };
+
+        struct Stats {
+            /// Glyphs rendered by FreeType.
+            uint64_t rasterized = 0;
+            /// Glyphs packed again from their kept bitmap after an eviction.
+            uint64_t repacked = 0;
+            /// Time spent loading the font, including the ASCII glyphs.
+            double load_ms = 0.0;
+            /// Bytes of glyph bitmaps kept on the CPU.
+            size_t bitmap_bytes = 0;
+            /// Time the FontLoader spent rasterizing the font on its thread.
+            double background_ms = 0.0;
+        };
+
+        /// The ASCII glyphs of a font rasterized by the FontLoader, packed
+        /// next to each other into one bitmap so that they take a single
+        /// upload once the GL thread picks them up.
+        struct Sheet {
+            int cap_height = 0;
+            int width = 0;
+            int height = 0;
+            /// One byte per pixel, `width` by `height`.
+            std::vector<unsigned char> pixels;
+            Glyph glyphs[128] = {};
+            /// Where each glyph sits on the sheet.
+            int x[128] = {};
+            int y[128] = {};
+            /// Offset of each glyph into `bitmaps`, kept for repacking.
+            size_t bitmap[128] = {};
+            std::vector<unsigned char> bitmaps;
+            double rasterize_ms = 0.0;
+            /// False when FreeType failed on the face.
+            bool is_loaded = false;
         };
 
         std::string file_path;
         unsigned int pixel_size = 0;
         Type type;
+        Rendering rendering = Rendering::Bitmap;
 
         unsigned int max_height = 0;
-        unsigned int atlas_width = 0;
-        unsigned int atlas_height = 0;
-        unsigned int atlas_ID;
-        std::map<char, Font::Character> characters;
+        /// False while the ASCII glyphs are rasterized in the background,
+        /// see FontCache::load(). Until then `metrics` only holds advances
+        /// estimated from the outlines and `max_height` is the pixel size,
+        /// text gets measured with those but isn't drawn.
+        bool is_ready = true;
+        /// The atlas of the FontCache, shared by every font. Its generation
+        /// tells when the texture coordinates of glyphs may have changed.
+        GlyphAtlas *atlas = nullptr;
+        Metrics metrics = {};
+        Stats stats;
+        /// Different for every Font ever created, unlike the address which
+        /// a Font created after this one got deleted may end up with.
+        uint64_t serial = ++serials;
 
+        /// Both load the face through the FontCache, which keeps it parsed
+        /// for the other sizes, but the Font itself is not shared. Fonts loaded
+        /// from memory keep referring to `data`, it has to stay around for the
+        /// rest of the process. FontCache::font() hands out shared instances.
+        /// Fonts created directly still pack into the shared atlas and have
+        /// to be deleted before the FontCache gets cleared, which happens
+        /// when the Application shuts down.
         Font(std::string file_path, unsigned int pixel_size, Type type);
         Font(const unsigned char *data, signed long length, unsigned int pixel_size, Type type);
+        /// Sizes an open `face` which has to outlive the Font. A deferred
+        /// font only estimates its metrics and waits for finishLoading().
+        Font(
+            FT_Face face, std::string file_path, unsigned int pixel_size, Type type,
+            Rendering rendering = Rendering::Bitmap, bool is_deferred = false
+        );
+        /// Sizes an open `face` with its ASCII glyphs taken from `baked`,
+        /// which only takes a single upload. See PrebakedFont.
+        Font(FT_Face face, std::string file_path, Type type, const PrebakedFont &baked);
+        /// A distance field font at another pixel size, its glyphs are the
+        /// ones of `source` scaled, nothing gets rasterized. `source` has to
+        /// outlive the Font. FontCache::font() creates both as needed.
+        Font(Font *source, unsigned int pixel_size);
         ~Font();
 
+        /// Returns the glyph of a codepoint, rasterizing it when it is first used.
+        /// Only the thread that owns the GL context may call it.
+        const Glyph& glyph(uint32_t codepoint);
+        /// Makes sure every character in the text has its glyph and marks
+        /// their pages as used. Afterwards laying the text out during the
+        /// same frame only reads from the font, which lets other threads do it.
+        void prepare(Slice<const char> text);
+        /// Decodes the UTF-8 character at `i` and moves `i` past it,
+        /// malformed sequences decode to U+FFFD one byte at a time.
+        static uint32_t decode(Slice<const char> text, size_t &i);
+        /// Rasterizes the ASCII glyphs of an already sized `face` onto
+        /// a sheet at most `max_width` wide. It only touches its arguments,
+        /// which lets the FontLoader call it with its own FreeType library.
+        static void rasterizeSheet(FT_Face face, int max_width, Sheet &sheet);
+        /// Uploads the glyphs of a sheet rasterized for a deferred font
+        /// and makes it ready, on the thread that owns the GL context.
+        void finishLoading(Sheet &sheet);
+
         private:
-            void load(FT_Face face);
+            /// A glyph along with where its bitmap is kept, glyphs on an
+            /// evicted page get packed again from the bitmap when used.
+            struct Entry {
+                Glyph glyph;
+                size_t bitmap;
+                bool is_packed;
+                /// The epoch of the page when the glyph was packed into it.
+                uint64_t epoch;
+            };
+
+            static uint64_t serials;
+
+            FT_Face m_face = nullptr;
+            /// The face is shared between sizes, each Font activates its own.
+            FT_Size m_size = nullptr;
+            /// Glyphs are positioned relative to the top of an 'H'.
+            int m_cap_height = 0;
+            std::unordered_map<uint32_t, Entry> m_glyphs;
+            /// The bitmaps of all rasterized glyphs, one byte per pixel.
+            std::vector<unsigned char> m_bitmaps;
+            /// Atlas pages pinned for the ASCII glyphs.
+            std::vector<uint16_t> m_pinned;
+            /// The distance field font the glyphs of a scaled font come from.
+            Font *m_source = nullptr;
+            float m_scale = 1.0f;
+
+            void load();
+            void estimate();
+            void setMetrics(uint32_t c, const Glyph &glyph);
+            void addSheet(Sheet &sheet);
+            void addAscii(uint32_t c, const Entry &entry);
+            const Glyph& scaledGlyph(uint32_t codepoint);
+            bool rasterize(uint32_t codepoint, Entry &entry);
+            static bool rasterize(
+                FT_Face face, Rendering rendering, int cap_height, uint32_t codepoint,
+                Glyph &glyph, std::vector<unsigned char> &bitmaps
+            );
+            void upload(Entry &entry);
+            void place(Entry &entry, uint16_t page, int x, int y);
+            bool isPacked(const Entry &entry);
     };
 #endif
@@ -0,0 +1,174 @@
+#include "font_cache.hpp"
+
+FontCache* FontCache::get() {
+    static FontCache *cache = new FontCache();
+    return cache;
+}
+
+FontCache::FontCache() {
+    if (FT_Init_FreeType(&library)) {
+        error("FAILED_TO_INITIALISE_FREETYPE");
+    }
+    // The outline and the bitmap distance field renderers.
+    FT_UInt spread = FONT_DISTANCE_FIELD_SPREAD;
+    FT_Property_Set(library, "sdf", "spread", &spread);
+    FT_Property_Set(library, "bsdf", "spread", &spread);
+}
+
+Font* FontCache::font(std::string file_path, unsigned int pixel_size, Font::Type type, Font::Rendering rendering) {
+    return font(face(file_path), file_path, pixel_size, type, rendering);
+}
+
+Font* FontCache::font(const unsigned char *data, signed long length, unsigned int pixel_size, Font::Type type, Font::Rendering rendering) {
+    return font(face(data, length), ":memory:", pixel_size, type, rendering, PrebakedFont::find(data, length, pixel_size));
+}
+
+Font* FontCache::font(
+    FT_Face face, std::string file_path, unsigned int pixel_size, Font::Type type,
+    Font::Rendering rendering, const PrebakedFont *baked
+) {
+    auto key = std::make_tuple(face, pixel_size, rendering);
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end()) {
+        return it->second;
+    }
+    Font *font;
+    if (rendering == Font::Rendering::DistanceField) {
+        auto source_key = std::make_tuple(face, 0u, rendering);
+        auto source = m_lookup.find(source_key);
+        if (source == m_lookup.end()) {
+            Font *loaded = new Font(face, file_path, FONT_DISTANCE_FIELD_SIZE, type, rendering);
+            source = m_lookup.insert(std::make_pair(source_key, loaded)).first;
+            m_fonts.push_back(loaded);
+        }
+        font = new Font(source->second, pixel_size);
+    } else if (baked) {
+        font = new Font(face, file_path, type, *baked);
+    } else {
+        font = new Font(face, file_path, pixel_size, type);
+    }
+    m_lookup.insert(std::make_pair(key, font));
+    m_fonts.push_back(font);
+    return font;
+}
+
+Font* FontCache::load(std::string file_path, unsigned int pixel_size, Font::Type type, std::function<void(Font*)> on_ready) {
+    return load(face(file_path), file_path, nullptr, 0, pixel_size, type, on_ready);
+}
+
+Font* FontCache::load(const unsigned char *data, signed long length, unsigned int pixel_size, Font::Type type, std::function<void(Font*)> on_ready) {
+    return load(face(data, length), ":memory:", data, length, pixel_size, type, on_ready);
+}
+
+Font* FontCache::load(
+    FT_Face face, std::string file_path, const unsigned char *data, signed long length,
+    unsigned int pixel_size, Font::Type type, std::function<void(Font*)> on_ready
+) {
+    auto key = std::make_tuple(face, pixel_size, Font::Rendering::Bitmap);
+    auto it = m_lookup.find(key);
+    Font *font;
+    const PrebakedFont *baked = data ? PrebakedFont::find(data, length, pixel_size) : nullptr;
+    if (it != m_lookup.end()) {
+        font = it->second;
+    } else if (baked) {
+        font = new Font(face, file_path, type, *baked);
+        m_lookup.insert(std::make_pair(key, font));
+        m_fonts.push_back(font);
+    } else {
+        font = new Font(face, file_path, pixel_size, type, Font::Rendering::Bitmap, true);
+        m_lookup.insert(std::make_pair(key, font));
+        m_fonts.push_back(font);
+        if (!m_loader) {
+            m_loader = new FontLoader();
+        }
+        // The sheet leaves room for the padding the atlas keeps around it.
+        m_loader->add(new FontLoader::Job{font, file_path, data, length, pixel_size, atlas()->page_size - 1, Font::Sheet()});
+    }
+    if (font->is_ready) {
+        m_ready.push_back(Callback(font, on_ready));
+        FontLoader::wake();
+    } else {
+        m_waiting.push_back(Callback(font, on_ready));
+    }
+    return font;
+}
+
+void FontCache::poll() {
+    if (m_loader) {
+        for (FontLoader::Job *job : m_loader->finished()) {
+            job->font->finishLoading(job->sheet);
+            for (size_t i = 0; i < m_waiting.size();) {
+                if (m_waiting[i].first == job->font) {
+                    m_ready.push_back(m_waiting[i]);
+                    m_waiting.erase(m_waiting.begin() + i);
+                } else {
+                    i++;
+                }
+            }
+            delete job;
+        }
+    }
+    if (m_ready.empty()) {
+        return;
+    }
+    // Callbacks may well load further fonts.
+    std::vector<Callback> ready;
+    std::swap(ready, m_ready);
+    for (Callback &callback : ready) {
+        if (callback.second) {
+            callback.second(callback.first);
+        }
+    }
+}
+
+FT_Face FontCache::face(std::string file_path) {
+    auto it = m_file_faces.find(file_path);
+    if (it != m_file_faces.end()) {
+        return it->second;
+    }
+    FT_Face face;
+    if (FT_New_Face(library, file_path.c_str(), 0, &face)) {
+        error("FAILED_TO_LOAD_FONT",  file_path);
+    }
+    m_file_faces.insert(std::make_pair(file_path, face));
+    return face;
+}
+
+FT_Face FontCache::face(const unsigned char *data, signed long length) {
+    auto it = m_memory_faces.find(data);
+    if (it != m_memory_faces.end()) {
+        return it->second;
+    }
+    FT_Face face;
+    if (FT_New_Memory_Face(library, data, length, 0, &face)) {
+        error("FAILED_TO_LOAD_FONT",  ":memory:");
+    }
+    m_memory_faces.insert(std::make_pair(data, face));
+    return face;
+}
+
+const std::vector<Font*>& FontCache::fonts() {
+    return m_fonts;
+}
+
+GlyphAtlas* FontCache::atlas() {
+    if (!m_atlas) {
+        m_atlas = new GlyphAtlas();
+    }
+    return m_atlas;
+}
+
+void FontCache::clear() {
+    if (m_loader) {
+        m_loader->cancel();
+    }
+    m_waiting.clear();
+    m_ready.clear();
+    for (Font *font : m_fonts) {
+        delete font;
+    }
+    m_fonts.clear();
+    m_lookup.clear();
+    delete m_atlas;
+    m_atlas = nullptr;
+}
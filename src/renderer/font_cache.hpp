@@ -0,0 +1,96 @@
+#ifndef FONT_CACHE_HPP
+    #define FONT_CACHE_HPP
+
+    #include <map>
+    #include <tuple>
+    #include <string>
+    #include <vector>
+    #include <utility>
+    #include <functional>
+    #include <unordered_map>
+
+    #include <ft2build.h>
+    #include FT_FREETYPE_H
+    #include FT_MODULE_H
+
+    #include "font.hpp"
+    #include "glyph_atlas.hpp"
+    #include "font_loader.hpp"
+    #include "prebaked_font.hpp"
+
+    /// Process wide owner of the FreeType library and of every parsed face.
+    /// Faces stay open for the rest of the process so that further sizes
+    /// of a face don't parse it again, and font() hands out one shared Font
+    /// per face and pixel size. Apart from the FontLoader, which has its own
+    /// library, FreeType is only ever used from the thread with the GL context.
+    struct FontCache {
+        FT_Library library = nullptr;
+
+        static FontCache* get();
+
+        /// Returns the shared Font for the face at the given size, loading it
+        /// the first time it is asked for. The cache owns the Font,
+        /// it must not be deleted by the caller. Distance field fonts of
+        /// a face share one font rasterized at FONT_DISTANCE_FIELD_SIZE,
+        /// further sizes only scale its metrics.
+        Font* font(std::string file_path, unsigned int pixel_size, Font::Type type, Font::Rendering rendering = Font::Rendering::Bitmap);
+        /// Memory faces are keyed by the address of `data`, which has to
+        /// stay around for the rest of the process. Sizes of embedded faces
+        /// that have a PrebakedFont skip rasterizing altogether.
+        Font* font(
+            const unsigned char *data, signed long length, unsigned int pixel_size,
+            Font::Type type, Font::Rendering rendering = Font::Rendering::Bitmap
+        );
+        /// Like font() but returns without rasterizing, the FontLoader does
+        /// that in the background and `on_ready` gets called by poll() once
+        /// the font is ready, on the next poll() when it already is.
+        /// Fonts with a PrebakedFont are ready right away. Distance field
+        /// fonts are always loaded by font().
+        Font* load(std::string file_path, unsigned int pixel_size, Font::Type type, std::function<void(Font*)> on_ready);
+        Font* load(
+            const unsigned char *data, signed long length, unsigned int pixel_size,
+            Font::Type type, std::function<void(Font*)> on_ready
+        );
+        /// Uploads the fonts the loader finished and calls their callbacks,
+        /// on the thread with the GL context. Cheap when nothing finished.
+        void poll();
+        FT_Face face(std::string file_path);
+        FT_Face face(const unsigned char *data, signed long length);
+        /// The shared fonts in the order they were loaded, see Font::stats.
+        const std::vector<Font*>& fonts();
+        /// The pages every Font packs its glyphs into, created along with
+        /// the first Font since it needs the GL context.
+        GlyphAtlas* atlas();
+        /// Deletes the shared fonts and the atlas, its pages live in the GL
+        /// context which is about to go away. Called by the Application
+        /// when it shuts down. Loading fonts get cancelled without their
+        /// callbacks. Faces stay open. Fonts created directly must already
+        /// be deleted, the atlas asserts that none of its pages are pinned.
+        void clear();
+
+        private:
+            typedef std::pair<Font*, std::function<void(Font*)>> Callback;
+
+            GlyphAtlas *m_atlas = nullptr;
+            FontLoader *m_loader = nullptr;
+            /// Callbacks of fonts the loader is still working on.
+            std::vector<Callback> m_waiting;
+            /// Callbacks for the next poll().
+            std::vector<Callback> m_ready;
+            std::unordered_map<std::string, FT_Face> m_file_faces;
+            std::unordered_map<const unsigned char*, FT_Face> m_memory_faces;
+            /// The distance field source of a face is kept at a pixel size of 0.
+            std::map<std::tuple<FT_Face, unsigned int, Font::Rendering>, Font*> m_lookup;
+            std::vector<Font*> m_fonts;
+
+            FontCache();
+            Font* font(
+                FT_Face face, std::string file_path, unsigned int pixel_size, Font::Type type,
+                Font::Rendering rendering, const PrebakedFont *baked = nullptr
+            );
+            Font* load(
+                FT_Face face, std::string file_path, const unsigned char *data, signed long length,
+                unsigned int pixel_size, Font::Type type, std::function<void(Font*)> on_ready
+            );
+    };
+#endif
@@ -0,0 +1,109 @@
+#include <SDL.h>
+#include <unordered_map>
+
+#include "font_loader.hpp"
+
+FontLoader::FontLoader() : m_has_finished{false} {
+    m_thread = std::thread(&FontLoader::work, this);
+}
+
+FontLoader::~FontLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+    for (Job *job : m_queue) { delete job; }
+    for (Job *job : m_finished) { delete job; }
+}
+
+void FontLoader::add(Job *job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(job);
+    }
+    m_wake.notify_one();
+}
+
+std::vector<FontLoader::Job*> FontLoader::finished() {
+    std::vector<Job*> jobs;
+    if (!m_has_finished) {
+        return jobs;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(jobs, m_finished);
+    m_has_finished = false;
+    return jobs;
+}
+
+void FontLoader::cancel() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (Job *job : m_queue) { delete job; }
+    m_queue.clear();
+    m_idle.wait(lock, [this] { return !m_is_busy; });
+    for (Job *job : m_finished) { delete job; }
+    m_finished.clear();
+    m_has_finished = false;
+}
+
+void FontLoader::wake() {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    SDL_PushEvent(&event);
+}
+
+// Faces stay open for the life of the thread, same as in the FontCache.
+// Jobs whose face fails to load finish with a sheet that isn't loaded.
+void FontLoader::work() {
+    FT_Library library = nullptr;
+    bool has_library = !FT_Init_FreeType(&library);
+    std::unordered_map<std::string, FT_Face> file_faces;
+    std::unordered_map<const unsigned char*, FT_Face> memory_faces;
+    while (true) {
+        Job *job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_quit || !m_queue.empty(); });
+            if (m_quit) { break; }
+            job = m_queue.front();
+            m_queue.pop_front();
+            m_is_busy = true;
+        }
+        FT_Face face = nullptr;
+        if (has_library && job->data) {
+            auto it = memory_faces.find(job->data);
+            if (it != memory_faces.end()) {
+                face = it->second;
+            } else if (!FT_New_Memory_Face(library, job->data, job->length, 0, &face)) {
+                memory_faces.insert(std::make_pair(job->data, face));
+            } else {
+                face = nullptr;
+            }
+        } else if (has_library) {
+            auto it = file_faces.find(job->file_path);
+            if (it != file_faces.end()) {
+                face = it->second;
+            } else if (!FT_New_Face(library, job->file_path.c_str(), 0, &face)) {
+                file_faces.insert(std::make_pair(job->file_path, face));
+            } else {
+                face = nullptr;
+            }
+        }
+        if (face && !FT_Set_Pixel_Sizes(face, 0, job->pixel_size)) {
+            Font::rasterizeSheet(face, job->max_width, job->sheet);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished.push_back(job);
+            m_has_finished = true;
+            m_is_busy = false;
+        }
+        m_idle.notify_all();
+        wake();
+    }
+    if (has_library) {
+        FT_Done_FreeType(library);
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef FONT_LOADER_HPP
+    #define FONT_LOADER_HPP
+
+    #include <atomic>
+    #include <deque>
+    #include <mutex>
+    #include <string>
+    #include <thread>
+    #include <vector>
+    #include <condition_variable>
+
+    #include "font.hpp"
+
+    /// A thread that rasterizes the ASCII glyphs of fonts for
+    /// FontCache::load() with a FreeType library and faces of its own,
+    /// which leaves only the upload to the thread with the GL context.
+    /// Every finished job gets announced with an SDL_USEREVENT so that
+    /// a window waiting for events wakes up and polls the FontCache.
+    struct FontLoader {
+        struct Job {
+            /// Only identifies the font, the loader never touches it.
+            Font *font;
+            std::string file_path;
+            /// The data of memory faces, nullptr for faces from `file_path`.
+            const unsigned char *data;
+            signed long length;
+            unsigned int pixel_size;
+            /// Sheets wider than this wrap, usually the atlas page size.
+            int max_width;
+            Font::Sheet sheet;
+        };
+
+        FontLoader();
+        ~FontLoader();
+
+        /// Queues the job, the loader owns it until finished() returns it.
+        void add(Job *job);
+        /// Returns the jobs finished since the last call, which are
+        /// the caller's to delete. Doesn't lock when there are none.
+        std::vector<Job*> finished();
+        /// Drops the queued jobs and waits for the one in progress,
+        /// the fonts they are for are about to go away.
+        void cancel();
+        /// Pushes the event that wakes up the event loop.
+        static void wake();
+
+        private:
+            std::thread m_thread;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_idle;
+            std::deque<Job*> m_queue;
+            std::vector<Job*> m_finished;
+            std::atomic<bool> m_has_finished;
+            bool m_is_busy = false;
+            bool m_quit = false;
+
+            void work();
+    };
+#endif
@@ -0,0 +1,40 @@
+#include "frame_buffer.hpp"
+
+FrameBuffer::FrameBuffer() {
+    glGenFramebuffers(1, &ID);
+    glGenTextures(1, &texture_ID);
+}
+
+FrameBuffer::~FrameBuffer() {
+    glDeleteFramebuffers(1, &ID);
+    glDeleteTextures(1, &texture_ID);
+}
+
+bool FrameBuffer::resize(Size size) {
+    if (this->size.w == size.w && this->size.h == size.h) { return false; }
+    this->size = size;
+    glBindTexture(GL_TEXTURE_2D, texture_ID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.w, size.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindFramebuffer(GL_FRAMEBUFFER, ID);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_ID, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        error("FRAMEBUFFER_INCOMPLETE");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return true;
+}
+
+void FrameBuffer::bind() {
+    glBindFramebuffer(GL_FRAMEBUFFER, ID);
+}
+
+void FrameBuffer::blit() {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, ID);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, size.w, size.h, 0, 0, size.w, size.h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
@@ -0,0 +1,30 @@
+#ifndef FRAME_BUFFER_HPP
+    #define FRAME_BUFFER_HPP
+
+    #include "glad.h"
+    #include "../util.hpp"
+    #include "../common/size.hpp"
+
+    /// An offscreen color target whose contents survive between frames,
+    /// unlike the back buffer which is undefined after every swap.
+    struct FrameBuffer {
+        unsigned int ID = 0;
+        /// The GL_TEXTURE_2D holding the color attachment.
+        unsigned int texture_ID = 0;
+        Size size;
+
+        FrameBuffer();
+        ~FrameBuffer();
+
+        /// Reallocates the storage when `size` differs from the current one.
+        /// Returns true when it did, the previous contents are lost then.
+        bool resize(Size size);
+
+        /// Makes the FrameBuffer the target of subsequent draws.
+        void bind();
+
+        /// Copies the whole FrameBuffer into the default framebuffer
+        /// and leaves the default framebuffer bound.
+        void blit();
+    };
+#endif
@@ -0,0 +1,188 @@
+#include <climits>
+#include <cassert>
+
+#include "glyph_atlas.hpp"
+
+uint64_t GlyphAtlas::frame = 0;
+
+GlyphAtlas::GlyphAtlas() {
+    int max_size = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if (max_size > 0 && max_size < page_size) {
+        page_size = max_size;
+    }
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    for (Page &page : pages) {
+        assert(!page.pins && "Fonts created directly have to be deleted before the FontCache gets cleared!");
+        glDeleteTextures(1, &page.ID);
+    }
+}
+
+bool GlyphAtlas::add(int w, int h, const unsigned char *bitmap, uint16_t &page, int &x, int &y) {
+    if (!pack(w, h, page, x, y)) {
+        return false;
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, pages[page].ID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RED, GL_UNSIGNED_BYTE, bitmap);
+    pages[page].last_used = frame;
+    return true;
+}
+
+void GlyphAtlas::use(uint16_t page) {
+    if (pages[page].last_used != frame) {
+        pages[page].last_used = frame;
+    }
+}
+
+void GlyphAtlas::pin(uint16_t page) {
+    pages[page].pins++;
+}
+
+void GlyphAtlas::unpin(uint16_t page) {
+    pages[page].pins--;
+}
+
+// Tries the existing pages first, then a new page while the budget allows
+// for it and then the least recently used page. When every page is pinned
+// or has been used during this frame a new one gets added regardless.
+bool GlyphAtlas::pack(int w, int h, uint16_t &page, int &x, int &y) {
+    // Keeps a pixel between glyphs so filtering never picks up a neighbour.
+    if (w + 1 > page_size || h + 1 > page_size) {
+        return false;
+    }
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (packInto(pages[i], w, h, x, y)) {
+            page = i;
+            return true;
+        }
+    }
+    size_t page_bytes = (size_t)page_size * page_size;
+    int evicted = -1;
+    if ((pages.size() + 1) * page_bytes > budget) {
+        evicted = evictPage();
+    }
+    if (evicted < 0) {
+        addPage();
+        evicted = pages.size() - 1;
+    }
+    page = evicted;
+    return packInto(pages[page], w, h, x, y);
+}
+
+// Bottom left skyline packing, the glyph goes wherever its bottom edge ends
+// up the lowest, preferring narrower segments to keep the gaps small.
+bool GlyphAtlas::packInto(Page &page, int w, int h, int &x, int &y) {
+    w += 1;
+    h += 1;
+    int best_bottom = INT_MAX;
+    int best_width = INT_MAX;
+    int best = -1;
+    for (size_t i = 0; i < page.skyline.size(); i++) {
+        int top = fit(page, i, w, h);
+        if (top < 0) { continue; }
+        if (top + h < best_bottom || (top + h == best_bottom && page.skyline[i].w < best_width)) {
+            best_bottom = top + h;
+            best_width = page.skyline[i].w;
+            best = i;
+            y = top;
+        }
+    }
+    if (best < 0) {
+        return false;
+    }
+    x = page.skyline[best].x;
+
+    page.skyline.insert(page.skyline.begin() + best, Segment{x, y + h, w});
+    // Cut the segments the glyph now covers.
+    for (size_t i = best + 1; i < page.skyline.size();) {
+        Segment &previous = page.skyline[i - 1];
+        Segment &segment = page.skyline[i];
+        int overlap = previous.x + previous.w - segment.x;
+        if (overlap <= 0) { break; }
+        if (overlap >= segment.w) {
+            page.skyline.erase(page.skyline.begin() + i);
+            continue;
+        }
+        segment.x += overlap;
+        segment.w -= overlap;
+        break;
+    }
+    for (size_t i = 1; i < page.skyline.size();) {
+        if (page.skyline[i - 1].y == page.skyline[i].y) {
+            page.skyline[i - 1].w += page.skyline[i].w;
+            page.skyline.erase(page.skyline.begin() + i);
+        } else {
+            i++;
+        }
+    }
+    return true;
+}
+
+// Returns the y a `w` by `h` rectangle would sit at when placed at the start
+// of segment `i`, or -1 when it would reach outside of the page.
+int GlyphAtlas::fit(const Page &page, size_t i, int w, int h) {
+    int x = page.skyline[i].x;
+    if (x + w > page_size) {
+        return -1;
+    }
+    int top = 0;
+    int width_left = w;
+    while (width_left > 0) {
+        const Segment &segment = page.skyline[i];
+        if (segment.y > top) { top = segment.y; }
+        if (top + h > page_size) {
+            return -1;
+        }
+        width_left -= segment.w;
+        i++;
+    }
+    return top;
+}
+
+void GlyphAtlas::addPage() {
+    Page page;
+    page.skyline.push_back(Segment{0, 0, page_size});
+    std::vector<unsigned char> zeros((size_t)page_size * page_size);
+    glActiveTexture(GL_TEXTURE0);
+    glGenTextures(1, &page.ID);
+    glBindTexture(GL_TEXTURE_2D, page.ID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, page_size, page_size, 0, GL_RED, GL_UNSIGNED_BYTE, zeros.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    page.last_used = frame;
+    pages.push_back(page);
+    stats.page_bytes = pages.size() * zeros.size();
+}
+
+// Empties the least recently used page that is neither pinned nor used during
+// this frame and returns its index, or -1 when there is no such page.
+int GlyphAtlas::evictPage() {
+    int lru = -1;
+    for (size_t i = 0; i < pages.size(); i++) {
+        const Page &page = pages[i];
+        if (page.pins || page.last_used == frame) { continue; }
+        if (lru < 0 || page.last_used < pages[lru].last_used) {
+            lru = i;
+        }
+    }
+    if (lru < 0) {
+        return -1;
+    }
+    Page &page = pages[lru];
+    page.skyline.clear();
+    page.skyline.push_back(Segment{0, 0, page_size});
+    page.last_used = frame;
+    page.epoch++;
+    std::vector<unsigned char> zeros((size_t)page_size * page_size);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, page.ID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, page_size, page_size, GL_RED, GL_UNSIGNED_BYTE, zeros.data());
+    generation++;
+    stats.evictions++;
+    return lru;
+}
@@ -0,0 +1,80 @@
+#ifndef GLYPH_ATLAS_HPP
+    #define GLYPH_ATLAS_HPP
+
+    #include <vector>
+    #include <cstddef>
+    #include <cstdint>
+
+    #include "glad.h"
+
+    // Bytes of glyph pages the atlas may hold before it starts evicting them.
+    #define GLYPH_ATLAS_BUDGET (8 * 1024 * 1024)
+    // Side of a page unless the GL limits textures to less than that.
+    #define GLYPH_ATLAS_PAGE_SIZE 1024
+
+    /// Single channel pages that the glyphs of every Font get packed into,
+    /// so that text in different faces and sizes shares texture slots and
+    /// batches. Glyphs are placed with a skyline packer which handles the
+    /// mix of glyph heights coming from different sizes well.
+    /// Once the pages take up more than `budget` bytes the least recently
+    /// used page gets emptied and reused, pages holding a pinned glyph and
+    /// pages used during the current frame are never evicted.
+    struct GlyphAtlas {
+        /// The top edge of the packed area over a horizontal span of a page.
+        struct Segment {
+            int x;
+            int y;
+            int w;
+        };
+
+        struct Page {
+            unsigned int ID;
+            std::vector<Segment> skyline;
+            /// The value of `GlyphAtlas::frame` when a glyph of the page was last used.
+            uint64_t last_used = 0;
+            /// Bumped when the page gets evicted, glyphs remember the epoch
+            /// they were packed in to tell whether they are still there.
+            uint64_t epoch = 0;
+            /// Number of fonts that need the page to stay around.
+            int pins = 0;
+        };
+
+        struct Stats {
+            uint64_t evictions = 0;
+            size_t page_bytes = 0;
+        };
+
+        /// Advanced by Renderer::endFrame(). Pages used during the current
+        /// frame are never evicted since batches which haven't been drawn
+        /// yet may still sample them.
+        static uint64_t frame;
+
+        /// Side of each page in pixels, at most GL_MAX_TEXTURE_SIZE.
+        int page_size = GLYPH_ATLAS_PAGE_SIZE;
+        size_t budget = GLYPH_ATLAS_BUDGET;
+        /// Bumped on every eviction, anything that kept the texture
+        /// coordinates of a glyph has to look it up again.
+        uint64_t generation = 0;
+        std::vector<Page> pages;
+        Stats stats;
+
+        GlyphAtlas();
+        ~GlyphAtlas();
+        /// Packs a `w` by `h` bitmap with one byte per pixel and uploads it,
+        /// returns false when it doesn't fit on a page.
+        bool add(int w, int h, const unsigned char *bitmap, uint16_t &page, int &x, int &y);
+        /// Marks the page as used during the current frame. Writes only once
+        /// per frame, which keeps reading glyphs safe for other threads after
+        /// their text has been prepared.
+        void use(uint16_t page);
+        void pin(uint16_t page);
+        void unpin(uint16_t page);
+
+        private:
+            bool pack(int w, int h, uint16_t &page, int &x, int &y);
+            bool packInto(Page &page, int w, int h, int &x, int &y);
+            int fit(const Page &page, size_t i, int w, int h);
+            void addPage();
+            int evictPage();
+    };
+#endif
@@ -0,0 +1,107 @@
+#include <cstring>
+
+#include "layer.hpp"
+
+Layer::Layer() {
+    for (int i = 0; i < 2; i++) {
+        buffers[i] = new FrameBuffer();
+        textures[i] = new Texture(buffers[i]->texture_ID, 0, 0, 0.0, 1.0, 1.0, 0.0);
+    }
+}
+
+Layer::~Layer() {
+    for (int i = 0; i < 2; i++) {
+        delete textures[i];
+        delete buffers[i];
+    }
+}
+
+void Layer::resize(Size size) {
+    for (int i = 0; i < 2; i++) {
+        if (buffers[i]->resize(size)) {
+            textures[i]->width = size.w;
+            textures[i]->height = size.h;
+            is_valid = false;
+        }
+    }
+}
+
+Size Layer::size() {
+    return buffers[front]->size;
+}
+
+Texture* Layer::texture() {
+    return textures[front];
+}
+
+TextureCoordinates Layer::coordinates(Rect rect) {
+    Size size = this->size();
+    float left = rect.x / (float)size.w;
+    float right = (rect.x + rect.w) / (float)size.w;
+    float top = rect.y / (float)size.h;
+    float bottom = (rect.y + rect.h) / (float)size.h;
+    TextureCoordinates coords;
+    coords.top_left = Point(left, bottom);
+    coords.bottom_left = Point(left, top);
+    coords.bottom_right = Point(right, top);
+    coords.top_right = Point(right, bottom);
+    return coords;
+}
+
+void Layer::update(Renderer *renderer, Point shift, const Rect *regions, size_t count) {
+    // Anything already batched belongs to whatever target is bound right now.
+    renderer->render();
+    GLint previous_frame_buffer;
+    GLint previous_viewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame_buffer);
+    glGetIntegerv(GL_VIEWPORT, previous_viewport);
+    float previous_projection[16];
+    memcpy(previous_projection, renderer->projection(), sizeof(previous_projection));
+    Size previous_target = renderer->target;
+
+    FrameBuffer *source = buffers[front];
+    FrameBuffer *target = buffers[!front];
+    Size size = target->size;
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, source->ID);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target->ID);
+    glBlitFramebuffer(
+        0, 0, size.w, size.h,
+        shift.x, -shift.y, size.w + shift.x, size.h - shift.y,
+        GL_COLOR_BUFFER_BIT, GL_NEAREST
+    );
+
+    target->bind();
+    glViewport(0, 0, size.w, size.h);
+    float projection[16] = {
+        2.0f / size.w, 0.0f, 0.0f, 0.0f,
+        0.0f, -2.0f / size.h, 0.0f, 0.0f,
+        0.0f, 0.0f, -1.0f, 0.0f,
+        -1.0f, 1.0f, -0.0f, 1.0f
+    };
+    renderer->setProjection(projection);
+    renderer->target = size;
+    glClearColor(0, 0, 0, 1);
+    for (size_t i = 0; i < count; i++) {
+        Rect region = regions[i];
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(region.x, size.h - (region.y + region.h), region.w, region.h);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDisable(GL_SCISSOR_TEST);
+        renderer->damage = Option<Rect>(region);
+        renderer->setClip(Rect(0, 0, size.w, size.h));
+        list.replay(renderer);
+        renderer->render();
+    }
+    renderer->damage = Option<Rect>();
+    // Blending leaves the alpha of antialiased text below one,
+    // the layer gets drawn as an opaque copy of the content.
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_TRUE);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previous_frame_buffer);
+    glViewport(previous_viewport[0], previous_viewport[1], previous_viewport[2], previous_viewport[3]);
+    renderer->setProjection(previous_projection);
+    renderer->target = previous_target;
+    front = !front;
+}
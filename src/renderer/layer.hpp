@@ -0,0 +1,52 @@
+#ifndef LAYER_HPP
+    #define LAYER_HPP
+
+    #include "../common/rect.hpp"
+    #include "../common/size.hpp"
+    #include "../common/point.hpp"
+
+    #include "texture.hpp"
+    #include "renderer.hpp"
+    #include "draw_list.hpp"
+    #include "frame_buffer.hpp"
+
+    /// Content rendered into an offscreen buffer once and then drawn as a
+    /// single texture, see ScrolledBox::setLayered().
+    /// The layer is double buffered, every update copies the current buffer
+    /// into the other one, possibly moved, redraws only the given regions
+    /// and then swaps them. Since each update changes the texture that gets
+    /// drawn the damage tracking of the Window picks it up like any other
+    /// change in the frame.
+    struct Layer {
+        FrameBuffer *buffers[2];
+        /// Wrap the color attachments of `buffers`, flipped vertically
+        /// since GL rows go bottom up while the layer is laid out top down.
+        Texture *textures[2];
+        int front = 0;
+        /// The part of the content held by the layer, in content coordinates.
+        Rect content;
+        /// The commands the layer was drawn from, in layer coordinates.
+        DrawList list;
+        /// Version of the content the layer was drawn from.
+        uint64_t version = 0;
+        bool is_valid = false;
+
+        Layer();
+        ~Layer();
+
+        /// Reallocates both buffers when `size` differs from the current one,
+        /// invalidating the layer.
+        void resize(Size size);
+        Size size();
+
+        /// The texture holding the current contents of the layer.
+        Texture* texture();
+
+        /// Returns the coordinates that sample `rect` of the layer.
+        TextureCoordinates coordinates(Rect rect);
+
+        /// Copies the current contents moved by `shift` into the other buffer,
+        /// draws `list` within each of `regions` over them and swaps the buffers.
+        void update(Renderer *renderer, Point shift, const Rect *regions, size_t count);
+    };
+#endif
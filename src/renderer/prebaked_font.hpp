@@ -0,0 +1,39 @@
+#ifndef PREBAKED_FONT_HPP
+    #define PREBAKED_FONT_HPP
+
+    #include <cstdint>
+
+    /// The ASCII glyphs of an embedded font rasterized ahead of time by
+    /// tools/bake_fonts.cpp, laid out the same way as a Font::Sheet.
+    /// The tables live in the generated prebaked_fonts.cpp, which has to be
+    /// regenerated with `make fonts` whenever the embedded fonts or FreeType
+    /// change. A font whose data no longer matches gets rasterized instead.
+    struct PrebakedFont {
+        struct Glyph {
+            int16_t advance;
+            int16_t offset_x;
+            int16_t offset_y;
+            int16_t width;
+            int16_t height;
+            /// Where the glyph sits on the sheet.
+            int16_t x;
+            int16_t y;
+        };
+
+        /// The embedded data of the face the glyphs were rasterized from.
+        const unsigned char *data;
+        unsigned int length;
+        unsigned int pixel_size;
+        int cap_height;
+        int width;
+        int height;
+        /// One byte per pixel, `width` by `height`.
+        const unsigned char *pixels;
+        /// Indexed by the character minus 32.
+        Glyph glyphs[96];
+
+        /// Returns the prebaked glyphs of the face in `data` at the pixel
+        /// size, or nullptr when there are none.
+        static const PrebakedFont* find(const unsigned char *data, signed long length, unsigned int pixel_size);
+    };
+#endif
@@ -0,0 +1,1125 @@
+// Generated by tools/bake_fonts.cpp, do not edit.
+#include "prebaked_font.hpp"
+#include "../resources.hpp"
+
+static const unsigned char DejaVuSans_ttf_14_pixels[] = {
+    0x00, 0xE4, 0x80, 0x00, 0xA8, 0x84, 0x10, 0xFF, 0x18, 0x00, 0x00, 0x00, 
+    0x00, 0x16, 0xF8, 0x08, 0x05, 0xF5, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xDD, 0xEA, 0x74, 0x00, 0x00, 
+    0x00, 0x17, 0xE2, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xB1, 0xF1, 
+    0xD9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x84, 0x00, 0x00, 0x18, 
+    0xE9, 0x1C, 0x00, 0x9E, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x60, 
+    0x00, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x97, 0x91, 0x00, 0x00, 0x00, 
+    0x5E, 0xDA, 0xF9, 0xD4, 0x4D, 0x00, 0x00, 0x0B, 0x65, 0xCE, 0xFF, 0x5C, 
+    0x00, 0x00, 0x00, 0x32, 0xA9, 0xE8, 0xED, 0xB8, 0x31, 0x00, 0x00, 0x19, 
+    0x91, 0xE0, 0xF4, 0xCE, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 
+    0xFF, 0xAC, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+    0x00, 0x00, 0x00, 0x1B, 0xA2, 0xEC, 0xEB, 0x91, 0x0B, 0x00, 0x00, 0xD8, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x09, 0x8F, 0xE2, 0xF8, 
+    0xDE, 0x83, 0x03, 0x00, 0x00, 0x0E, 0x91, 0xE2, 0xF7, 0xC8, 0x3B, 0x00, 
+    0x00, 0x5C, 0xFF, 0x14, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x05, 0x52, 0xB5, 0x3C, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x76, 0x9A, 0x37, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xC4, 0xF3, 0xE0, 0x70, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x69, 0xC2, 0xEF, 0xF6, 0xD7, 0x8B, 0x18, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xC5, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xEE, 0xBC, 0x35, 0x00, 0x00, 
+    0x00, 0x00, 0x14, 0x8E, 0xDC, 0xF8, 0xE4, 0xB3, 0x40, 0x00, 0x00, 0xA0, 
+    0xFF, 0xFF, 0xFB, 0xEA, 0xBE, 0x68, 0x04, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 
+    0x00, 0x00, 0x00, 0x13, 0x8B, 0xD9, 0xF8, 0xEA, 0xC6, 0x6B, 0x0A, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0xA0, 0xC0, 
+    0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x43, 
+    0xF3, 0x8F, 0x01, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xA0, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xB8, 0x00, 0xA0, 
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x1A, 
+    0x98, 0xE4, 0xFA, 0xE4, 0x9A, 0x1A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 
+    0xFB, 0xDE, 0x89, 0x0A, 0x00, 0x00, 0x00, 0x1A, 0x98, 0xE4, 0xFA, 0xE4, 
+    0x9A, 0x1A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFB, 0xDF, 0x8E, 0x0C, 
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x8E, 0xDF, 0xF6, 0xD4, 0x7D, 0x0F, 0x00, 
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 
+    0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x08, 0x00, 0xB3, 0xBC, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0x45, 0x00, 0x68, 0xF5, 0x06, 
+    0x00, 0x00, 0x06, 0xF6, 0xD3, 0x00, 0x00, 0x00, 0x25, 0xFF, 0x42, 0x00, 
+    0x03, 0xC6, 0xB2, 0x00, 0x00, 0x00, 0x0B, 0xDA, 0x95, 0x00, 0x00, 0x00, 
+    0xAF, 0xC7, 0x03, 0x00, 0x00, 0x00, 0x41, 0xFC, 0x3D, 0x00, 0x38, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xCC, 0xFF, 0xFF, 0x1C, 
+    0x00, 0xDA, 0x4D, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0x44, 0x00, 
+    0x00, 0x00, 0x00, 0x49, 0xFA, 0xE1, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x24, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x00, 0x79, 0xCD, 0x04, 
+    0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xED, 0xB5, 0x25, 0x00, 0x00, 0xBC, 
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0xDA, 
+    0xF7, 0xCA, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x9C, 
+    0x00, 0x00, 0x01, 0x72, 0xDC, 0xF8, 0xD6, 0x64, 0x00, 0x00, 0x00, 0x02, 
+    0x9C, 0xEE, 0xFF, 0x34, 0x00, 0x00, 0x0A, 0x9F, 0xF3, 0xE5, 0x9A, 0xB0, 
+    0x9C, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 
+    0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0xA2, 0xAD, 0xE9, 0xEF, 0x8C, 
+    0x1D, 0xB0, 0xF4, 0xE5, 0x6C, 0x00, 0x00, 0xBC, 0x9B, 0xA3, 0xE8, 0xEB, 
+    0x92, 0x03, 0x00, 0x00, 0x06, 0x8B, 0xE7, 0xF9, 0xCB, 0x42, 0x00, 0x00, 
+    0xBC, 0x9C, 0xA9, 0xEA, 0xED, 0x89, 0x02, 0x00, 0x00, 0x00, 0x08, 0x9B, 
+    0xF2, 0xE5, 0x9A, 0xB0, 0x9C, 0x00, 0xBC, 0x9C, 0xA8, 0xF2, 0xBF, 0x00, 
+    0x00, 0x47, 0xCD, 0xF5, 0xDB, 0x76, 0x03, 0x00, 0x00, 0xB4, 0x90, 0x00, 
+    0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0xA8, 0x9C, 0x00, 0x67, 
+    0xE9, 0x04, 0x00, 0x00, 0x00, 0xA6, 0xB1, 0x00, 0x49, 0xF3, 0x04, 0x00, 
+    0x25, 0xFF, 0x97, 0x00, 0x00, 0x85, 0xBB, 0x00, 0x15, 0xE7, 0x7E, 0x00, 
+    0x00, 0x2E, 0xF8, 0x54, 0x00, 0x62, 0xEA, 0x05, 0x00, 0x00, 0x00, 0xA9, 
+    0xAE, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
+    0x00, 0x70, 0xE3, 0xFC, 0x28, 0x00, 0x38, 0xF0, 0x00, 0x40, 0xFC, 0xDE, 
+    0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x04, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 
+    0x00, 0x00, 0xE4, 0x80, 0x00, 0xA8, 0x84, 0x10, 0xFF, 0x18, 0x00, 0x00, 
+    0x00, 0x00, 0x53, 0xC5, 0x00, 0x38, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x50, 0x26, 0xEE, 0x2F, 
+    0x00, 0x00, 0xAA, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xBC, 
+    0x17, 0x1D, 0x9E, 0x17, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x84, 0x00, 0x00, 
+    0x9D, 0x8F, 0x00, 0x00, 0x1F, 0xF4, 0x1C, 0x00, 0x00, 0x56, 0x94, 0x10, 
+    0xC8, 0x10, 0x94, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x70, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x7D, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x45, 0x00, 0x00, 
+    0x48, 0xFB, 0x5E, 0x11, 0x72, 0xFB, 0x33, 0x00, 0x6C, 0x9C, 0x33, 0xFF, 
+    0x5C, 0x00, 0x00, 0x00, 0xB4, 0x55, 0x17, 0x15, 0x9B, 0xEE, 0x1B, 0x00, 
+    0x82, 0x63, 0x1B, 0x0D, 0x65, 0xFD, 0x47, 0x00, 0x00, 0x00, 0x00, 0x30, 
+    0xE1, 0xC9, 0xAC, 0x00, 0x00, 0x00, 0x7C, 0xC8, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x12, 0xE0, 0xB1, 0x20, 0x0B, 0x69, 0x50, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0x5A, 0x00, 0x00, 0x91, 0xE4, 0x33, 
+    0x08, 0x40, 0xF1, 0x78, 0x00, 0x00, 0xAE, 0xD6, 0x2D, 0x0C, 0x6B, 0xF4, 
+    0x23, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x29, 0x8C, 0xEA, 0xF2, 0x9D, 0x18, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xB7, 0xFC, 0xD4, 
+    0x71, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x32, 0x08, 0x5C, 0xFF, 
+    0x43, 0x00, 0x00, 0x00, 0x20, 0xD2, 0xB7, 0x49, 0x19, 0x08, 0x2C, 0x85, 
+    0xE7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xCA, 0xFD, 0x29, 
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x17, 0xA5, 0xED, 0x06, 
+    0x00, 0x00, 0x1B, 0xE1, 0xBE, 0x38, 0x08, 0x19, 0x48, 0xBD, 0x03, 0x00, 
+    0xA0, 0xC0, 0x00, 0x02, 0x18, 0x5B, 0xE2, 0xC2, 0x08, 0x00, 0xA0, 0xC0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1C, 0xE1, 0xBF, 0x3C, 0x09, 0x12, 0x36, 0x92, 0x64, 
+    0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x53, 
+    0xF8, 0x7B, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xA0, 0xE0, 0xF5, 0x0E, 0x00, 0x00, 0x05, 0xE8, 0xE0, 0xB8, 0x00, 
+    0xA0, 0xF7, 0xF3, 0x17, 0x00, 0x00, 0x3C, 0xFF, 0x18, 0x00, 0x00, 0x1E, 
+    0xE6, 0xB8, 0x2C, 0x06, 0x29, 0xB3, 0xE6, 0x1E, 0x00, 0x00, 0xA0, 0xC0, 
+    0x00, 0x05, 0x42, 0xF0, 0x93, 0x00, 0x00, 0x1E, 0xE6, 0xB8, 0x2C, 0x06, 
+    0x29, 0xB3, 0xE6, 0x1E, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x04, 0x3C, 0xEC, 
+    0x96, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xD1, 0x33, 0x09, 0x28, 0x7F, 0x70, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x08, 0x00, 0x4F, 
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xE0, 0x02, 0x00, 0x26, 0xFF, 
+    0x3C, 0x00, 0x00, 0x3D, 0xE7, 0xF9, 0x15, 0x00, 0x00, 0x65, 0xF8, 0x08, 
+    0x00, 0x00, 0x25, 0xF5, 0x60, 0x00, 0x00, 0x9B, 0xD7, 0x09, 0x00, 0x00, 
+    0x00, 0x15, 0xE9, 0x7C, 0x00, 0x00, 0x0E, 0xE0, 0x8A, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x71, 0x00, 0xCC, 0x78, 0x00, 
+    0x00, 0x00, 0x8F, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x44, 
+    0x00, 0x00, 0x00, 0x3B, 0xF5, 0x84, 0xBB, 0xD7, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 
+    0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x99, 0xD5, 0x04, 0x00, 
+    0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 
+    0x4F, 0x0E, 0x35, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 
+    0x9C, 0x00, 0x00, 0x7E, 0xD5, 0x36, 0x0A, 0x3F, 0xEA, 0x58, 0x00, 0x00, 
+    0x50, 0xEE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x94, 0xDC, 0x31, 0x13, 0x8D, 
+    0xFF, 0x9C, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 
+    0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0xFC, 0x5C, 0x0C, 0x4B, 
+    0xFE, 0xE9, 0x57, 0x0C, 0x54, 0xFD, 0x29, 0x00, 0xBC, 0xFD, 0x60, 0x0D, 
+    0x36, 0xF1, 0x62, 0x00, 0x00, 0x8A, 0xE2, 0x38, 0x11, 0x80, 0xF8, 0x21, 
+    0x00, 0xBC, 0xFF, 0x76, 0x10, 0x3F, 0xEB, 0x72, 0x00, 0x00, 0x00, 0x8F, 
+    0xDC, 0x31, 0x13, 0x90, 0xFF, 0x9C, 0x00, 0xBC, 0xFE, 0x67, 0x0C, 0x00, 
+    0x00, 0x0C, 0xF6, 0x6C, 0x0A, 0x20, 0x86, 0x30, 0x00, 0x00, 0xB4, 0x90, 
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0xA8, 0x9C, 0x00, 
+    0x11, 0xF9, 0x48, 0x00, 0x00, 0x0B, 0xF5, 0x55, 0x00, 0x0C, 0xFB, 0x38, 
+    0x00, 0x65, 0xEB, 0xD8, 0x00, 0x00, 0xC5, 0x7B, 0x00, 0x00, 0x47, 0xFA, 
+    0x39, 0x09, 0xD5, 0x9F, 0x00, 0x00, 0x0B, 0xF2, 0x52, 0x00, 0x00, 0x12, 
+    0xF8, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xEF, 0x7D, 0x00, 0x00, 
+    0x00, 0x09, 0xFA, 0x6E, 0x06, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x07, 
+    0x82, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9B, 0xE3, 0xF1, 0xAE, 0x4E, 
+    0x0D, 0x21, 0x9C, 0x3F, 0x00, 0x4C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 
+    0xB4, 0x00, 0x00, 0xE4, 0x80, 0x00, 0xA8, 0x84, 0x10, 0xFF, 0x18, 0x00, 
+    0x00, 0x00, 0x00, 0x8E, 0x89, 0x00, 0x75, 0xA5, 0x00, 0x00, 0x00, 0x0C, 
+    0x94, 0xE4, 0xFF, 0xD3, 0x61, 0x01, 0x00, 0x2C, 0xE9, 0x00, 0x00, 0xAA, 
+    0x6B, 0x00, 0x4D, 0xC8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 
+    0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x84, 0x00, 
+    0x17, 0xF9, 0x29, 0x00, 0x00, 0x00, 0xB8, 0x84, 0x00, 0x00, 0x00, 0x41, 
+    0xB4, 0xEB, 0xB4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x70, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x06, 0x00, 
+    0x00, 0xBC, 0xAE, 0x00, 0x00, 0x00, 0xCB, 0xA3, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x60, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x7F, 0x00, 0x00, 0x00, 0x0C, 
+    0xD8, 0x4A, 0xB4, 0xAC, 0x00, 0x00, 0x00, 0x7C, 0xC8, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x8A, 0xE7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xED, 0x08, 0x00, 0x00, 0xC3, 0x9C, 
+    0x00, 0x00, 0x00, 0xB5, 0xAB, 0x00, 0x0A, 0xFD, 0x5B, 0x00, 0x00, 0x00, 
+    0xCB, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0C, 0x63, 0xC6, 0xFE, 0xBF, 0x5E, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 
+    0x79, 0xD9, 0xF9, 0xAB, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+    0xFB, 0x5D, 0x00, 0x00, 0x0E, 0xD9, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x31, 0xE6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x4A, 0xBA, 
+    0x8C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x40, 0xFF, 
+    0x25, 0x00, 0x00, 0xAE, 0xE1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x22, 0xF8, 0x76, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x65, 
+    0xFA, 0x67, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xA0, 0xB8, 0xC8, 0x66, 0x00, 0x00, 0x52, 0xDA, 0xA4, 0xB8, 
+    0x00, 0xA0, 0xB9, 0xCF, 0x96, 0x00, 0x00, 0x3C, 0xFF, 0x18, 0x00, 0x00, 
+    0xAF, 0xE1, 0x07, 0x00, 0x00, 0x00, 0x04, 0xDC, 0xB1, 0x00, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x00, 0x91, 0xE1, 0x00, 0x00, 0xAF, 0xE1, 0x07, 0x00, 
+    0x00, 0x00, 0x04, 0xDC, 0xB1, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 
+    0x8F, 0xE1, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x5E, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x08, 0x00, 
+    0x04, 0xE7, 0x81, 0x00, 0x00, 0x00, 0x05, 0xE9, 0x7E, 0x00, 0x00, 0x00, 
+    0xE5, 0x7D, 0x00, 0x00, 0x7E, 0xA3, 0xC5, 0x55, 0x00, 0x00, 0xA6, 0xBF, 
+    0x00, 0x00, 0x00, 0x00, 0x6D, 0xF0, 0x1C, 0x4E, 0xFA, 0x32, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x4F, 0xFA, 0x31, 0x00, 0x9E, 0xD3, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF4, 0xA2, 0x00, 0x00, 0xCC, 0x78, 
+    0x00, 0x00, 0x00, 0x43, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+    0x44, 0x00, 0x00, 0x2F, 0xEE, 0x72, 0x00, 0x07, 0xB0, 0xCC, 0x0D, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x15, 0xDD, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2E, 
+    0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 
+    0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xA4, 0x9C, 0x00, 0x08, 0xF4, 0x44, 0x00, 0x00, 0x00, 0x7E, 0xBB, 0x00, 
+    0x00, 0x74, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x55, 0x00, 0x00, 
+    0x03, 0xE2, 0x9C, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x88, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0xAD, 0x00, 0x00, 
+    0x00, 0xD4, 0xA5, 0x00, 0x00, 0x00, 0xE0, 0x63, 0x00, 0xBC, 0xAE, 0x00, 
+    0x00, 0x00, 0xA5, 0x9F, 0x00, 0x08, 0xF8, 0x5D, 0x00, 0x00, 0x00, 0xCF, 
+    0x90, 0x00, 0xBC, 0xCA, 0x00, 0x00, 0x00, 0x74, 0xE4, 0x00, 0x00, 0x09, 
+    0xF7, 0x56, 0x00, 0x00, 0x04, 0xE4, 0x9C, 0x00, 0xBC, 0xB9, 0x00, 0x00, 
+    0x00, 0x00, 0x22, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0x28, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0xA8, 0x9C, 
+    0x00, 0x00, 0xB0, 0xA3, 0x00, 0x00, 0x5C, 0xF1, 0x08, 0x00, 0x00, 0xC9, 
+    0x79, 0x00, 0xA5, 0x7F, 0xF7, 0x19, 0x0A, 0xFA, 0x3B, 0x00, 0x00, 0x00, 
+    0x90, 0xDE, 0x9F, 0xDC, 0x0C, 0x00, 0x00, 0x00, 0x99, 0xB4, 0x00, 0x00, 
+    0x6D, 0xE6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD6, 0xAF, 0x01, 0x00, 
+    0x00, 0x00, 0x1E, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 
+    0x00, 0x40, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x75, 0x67, 0x0F, 0x18, 0x68, 
+    0xC5, 0xF6, 0xD7, 0x78, 0x05, 0x00, 0x4C, 0x7C, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0xB4, 0x00, 0x00, 0xE3, 0x7F, 0x00, 0xA8, 0x84, 0x10, 0xFF, 0x18, 
+    0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 
+    0x94, 0xCF, 0x27, 0xB2, 0x30, 0xA0, 0x1E, 0x00, 0x2C, 0xE9, 0x00, 0x00, 
+    0xAA, 0x6B, 0x0D, 0xDD, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xB2, 0xC1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x84, 
+    0x00, 0x69, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xDD, 0x00, 0x00, 0x00, 
+    0x41, 0xB4, 0xEB, 0xB4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xAD, 0x00, 
+    0x00, 0x01, 0xF4, 0x6E, 0x00, 0x00, 0x00, 0x88, 0xDD, 0x00, 0x00, 0x00, 
+    0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFE, 
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x5F, 0xF4, 0x33, 0x00, 0x00, 0x00, 
+    0xA1, 0x94, 0x00, 0xB4, 0xAC, 0x00, 0x00, 0x00, 0x7C, 0xF7, 0xF3, 0xEB, 
+    0xB5, 0x2D, 0x00, 0x00, 0x00, 0xDA, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE7, 0x90, 0x00, 0x00, 0x00, 0x6B, 
+    0xE3, 0x31, 0x07, 0x3E, 0xED, 0x52, 0x00, 0x0B, 0xFE, 0x5A, 0x00, 0x00, 
+    0x00, 0xCB, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x5D, 0xF3, 0xE0, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x3B, 0x9C, 0xF2, 0xE3, 0x2A, 0x00, 0x00, 0x00, 0x02, 
+    0x9D, 0xDC, 0x10, 0x00, 0x00, 0x82, 0x99, 0x00, 0x0A, 0x9D, 0xF0, 0xE2, 
+    0x6E, 0xE8, 0x00, 0x6C, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xE2, 0x02, 
+    0x54, 0xEA, 0x05, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x16, 0xA2, 
+    0xDC, 0x05, 0x00, 0x0C, 0xFB, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC9, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x28, 
+    0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0xC0, 0x78, 
+    0xF8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xA0, 0xB8, 0x65, 0xC8, 0x00, 0x00, 0xB6, 0x78, 0xA4, 
+    0xB8, 0x00, 0xA0, 0xB8, 0x47, 0xFB, 0x26, 0x00, 0x3C, 0xFF, 0x18, 0x00, 
+    0x0D, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFC, 0x0F, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x91, 0xE1, 0x00, 0x0D, 0xFC, 0x78, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFC, 0x0E, 0x00, 0xA0, 0xC0, 0x00, 0x00, 
+    0x00, 0x90, 0xE8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x9F, 0x05, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x08, 
+    0x00, 0x00, 0x88, 0xE1, 0x02, 0x00, 0x00, 0x52, 0xFD, 0x1D, 0x00, 0x00, 
+    0x00, 0xA4, 0xBE, 0x00, 0x00, 0xBF, 0x63, 0x86, 0x96, 0x00, 0x00, 0xE6, 
+    0x7E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xC1, 0xEA, 0x79, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xD4, 0x55, 0xF9, 0x30, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xDF, 0xCA, 0x08, 0x00, 0x00, 0xCC, 
+    0x78, 0x00, 0x00, 0x00, 0x05, 0xF1, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x44, 0x00, 0x24, 0xE6, 0x65, 0x00, 0x00, 0x00, 0x04, 0xA3, 0xBF, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xB2, 0xEA, 0xFE, 0xFF, 0xFF, 
+    0x4C, 0x00, 0xBC, 0x9C, 0xA9, 0xEA, 0xED, 0x89, 0x02, 0x00, 0x00, 0x32, 
+    0xFF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9B, 0xF2, 0xE5, 
+    0x9A, 0xB0, 0x9C, 0x00, 0x31, 0xFF, 0xFC, 0xFC, 0xFD, 0xFE, 0xFF, 0xDD, 
+    0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x2B, 0xFF, 0x22, 0x00, 
+    0x00, 0x00, 0xB2, 0x9C, 0x00, 0xBC, 0x9B, 0xA3, 0xE8, 0xEB, 0x92, 0x03, 
+    0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 0x00, 
+    0x00, 0x4C, 0xF2, 0x5D, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x89, 0x00, 
+    0x00, 0x00, 0xC4, 0x81, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0xBC, 0x89, 
+    0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0x2A, 0xFF, 0x26, 0x00, 0x00, 0x00, 
+    0x97, 0xBA, 0x00, 0xBC, 0x96, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x0E, 0x00, 
+    0x2B, 0xFF, 0x22, 0x00, 0x00, 0x00, 0xB3, 0x9C, 0x00, 0xBC, 0x8E, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0xB6, 0xE5, 0x8D, 0x4C, 0x09, 0x00, 0x00, 0x00, 
+    0xB4, 0x90, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0xA8, 
+    0x9C, 0x00, 0x00, 0x54, 0xF3, 0x0A, 0x00, 0xB7, 0x9D, 0x00, 0x00, 0x00, 
+    0x89, 0xB9, 0x00, 0xE4, 0x36, 0xC1, 0x59, 0x45, 0xF5, 0x05, 0x00, 0x00, 
+    0x00, 0x07, 0xD8, 0xFD, 0x37, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFC, 0x19, 
+    0x00, 0xCF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB2, 0xD3, 0x0C, 0x00, 
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x00, 
+    0x00, 0x00, 0x3C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x7C, 0x00, 0x00, 0x00, 
+    0x00, 0x14, 0xB4, 0x00, 0x00, 0xDA, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xF8, 0x0C, 0x07, 0xF4, 0x1F, 0x00, 0x00, 
+    0x00, 0xCC, 0x77, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEA, 0x4F, 
+    0x24, 0xEE, 0x30, 0x95, 0x83, 0x3B, 0xD8, 0xEC, 0x7E, 0x00, 0x00, 0x00, 
+    0x04, 0x9F, 0xFF, 0x9F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xA5, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0x1B, 0x00, 
+    0x56, 0x95, 0x10, 0xC8, 0x10, 0x95, 0x56, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x61, 
+    0x00, 0x00, 0x0E, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x72, 0xF5, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
+    0xE1, 0x0A, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xF7, 0x5B, 0x00, 0x00, 0x00, 
+    0x5C, 0xD6, 0x09, 0x00, 0xB4, 0xAC, 0x00, 0x00, 0x00, 0x64, 0x59, 0x11, 
+    0x21, 0xA6, 0xF1, 0x1D, 0x00, 0x00, 0xFB, 0x84, 0xB6, 0xF7, 0xE1, 0x8D, 
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x2B, 0x00, 0x00, 0x00, 
+    0x00, 0x8E, 0xFF, 0xFF, 0xFD, 0x77, 0x00, 0x00, 0x00, 0xB5, 0xD4, 0x2C, 
+    0x0B, 0x68, 0xFD, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x5D, 0xF4, 0xDF, 0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x3A, 0x9B, 0xF2, 0xE3, 0x2A, 0x00, 0x00, 0x00, 
+    0xA3, 0xD5, 0x1C, 0x00, 0x00, 0x00, 0xDE, 0x26, 0x00, 0x87, 0xC3, 0x1D, 
+    0x1A, 0xC0, 0xE8, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x7F, 
+    0x00, 0x05, 0xE8, 0x53, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xE7, 0x37, 0x00, 0x00, 0x2E, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xEA, 
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 0xA0, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x2F, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0xF9, 
+    0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xB8, 0x0D, 0xF4, 0x2B, 0x1C, 0xF9, 0x19, 
+    0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0xBD, 0xAC, 0x00, 0x3C, 0xFF, 0x18, 
+    0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x32, 
+    0x00, 0xA0, 0xC0, 0x00, 0x04, 0x3F, 0xEF, 0x95, 0x00, 0x2F, 0xFF, 0x50, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x31, 0x00, 0xA0, 0xC0, 0x00, 
+    0x04, 0x3B, 0xEC, 0x90, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xF4, 0xEC, 0xB1, 
+    0x76, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 
+    0x08, 0x00, 0x00, 0x25, 0xFF, 0x46, 0x00, 0x00, 0xB5, 0xB7, 0x00, 0x00, 
+    0x00, 0x00, 0x63, 0xF7, 0x07, 0x08, 0xF7, 0x23, 0x47, 0xD7, 0x00, 0x28, 
+    0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xCD, 0x02, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xE0, 0xFD, 0x79, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBE, 0xE7, 0x1B, 0x00, 0x00, 0x00, 
+    0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x7D, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE1, 0x97, 0x1F, 0x05, 0x02, 
+    0xFA, 0x50, 0x00, 0xBC, 0xFF, 0x76, 0x10, 0x3F, 0xEB, 0x72, 0x00, 0x00, 
+    0x33, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xDC, 0x31, 
+    0x13, 0x90, 0xFF, 0x9C, 0x00, 0x33, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x21, 
+    0x00, 0x00, 0x00, 0xB3, 0x9C, 0x00, 0xBC, 0xFD, 0x60, 0x0D, 0x36, 0xF1, 
+    0x62, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 
+    0x00, 0x5D, 0xF2, 0x4C, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 
+    0x00, 0x00, 0x00, 0xC4, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0xBC, 
+    0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0x2B, 0xFF, 0x26, 0x00, 0x00, 
+    0x00, 0x98, 0xB9, 0x00, 0xBC, 0x95, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x0E, 
+    0x00, 0x2B, 0xFF, 0x21, 0x00, 0x00, 0x00, 0xB3, 0x9C, 0x00, 0xBC, 0x88, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x84, 0xD1, 0xE5, 0x2A, 0x00, 
+    0x00, 0xB4, 0x90, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 
+    0xAA, 0x9C, 0x00, 0x00, 0x08, 0xF0, 0x59, 0x16, 0xFB, 0x41, 0x00, 0x00, 
+    0x00, 0x49, 0xF4, 0x2A, 0xF1, 0x03, 0x81, 0x9A, 0x85, 0xBB, 0x00, 0x00, 
+    0x00, 0x00, 0x27, 0xF5, 0xFC, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 
+    0x78, 0x30, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x86, 0xEC, 0x21, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x38, 0xF0, 
+    0x00, 0x00, 0x00, 0x36, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x7C, 0x00, 0x00, 
+    0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0xC9, 0x64, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xBC, 0x00, 0x44, 0xD7, 0x00, 0x00, 
+    0x00, 0x00, 0x95, 0xD5, 0x39, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
+    0xDE, 0xEB, 0x76, 0x39, 0xD6, 0x0A, 0xDF, 0x5B, 0x1F, 0xE8, 0x39, 0x00, 
+    0x00, 0x94, 0xCF, 0x37, 0xDF, 0xB0, 0x08, 0x00, 0x5F, 0xEA, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xC1, 0x91, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x38, 
+    0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFB, 
+    0x17, 0x00, 0x00, 0x0E, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x73, 0xF4, 0x00, 
+    0x00, 0x00, 0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 
+    0xF3, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x66, 0xFA, 0x4E, 0x00, 
+    0x21, 0xEC, 0x31, 0x00, 0x00, 0xB4, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0xE5, 0x82, 0x00, 0x00, 0xFC, 0xF9, 0x56, 0x0B, 0x35, 
+    0xE2, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xC6, 0x00, 0x00, 0x00, 
+    0x00, 0x89, 0xE1, 0x37, 0x0A, 0x42, 0xED, 0x6E, 0x00, 0x00, 0x14, 0x9D, 
+    0xE7, 0xF6, 0xAE, 0x95, 0xE2, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x5C, 0xFF, 
+    0x14, 0x00, 0x00, 0x0C, 0x64, 0xC7, 0xFE, 0xBE, 0x5D, 0x0A, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1A, 0x78, 0xD9, 0xFA, 0xAC, 0x49, 0x02, 0x00, 0x00, 0x00, 
+    0x2D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, 0x00, 0xD0, 0x48, 
+    0x00, 0x00, 0x41, 0xE8, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x24, 0xFC, 
+    0x1D, 0x00, 0x00, 0x87, 0xB7, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 
+    0x11, 0x7F, 0xF0, 0x23, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 
+    0xE9, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 
+    0xEC, 0xFF, 0xFF, 0xB4, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 
+    0xFF, 0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 
+    0xD3, 0xD6, 0xD1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB8, 0x00, 0x9F, 0x8D, 0x7D, 0xB2, 
+    0x00, 0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0x34, 0xFE, 0x37, 0x3C, 0xFF, 
+    0x18, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 
+    0x31, 0x00, 0xA0, 0xFF, 0xFF, 0xFB, 0xDF, 0x8D, 0x0B, 0x00, 0x2F, 0xFF, 
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x2D, 0x00, 0xA0, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xAF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5A, 
+    0x94, 0xDA, 0xFB, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x5C, 
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xC1, 0xA8, 0x00, 0x1A, 0xFC, 0x53, 0x00, 
+    0x00, 0x00, 0x00, 0x22, 0xFF, 0x40, 0x41, 0xE3, 0x00, 0x0C, 0xFB, 0x18, 
+    0x69, 0xF5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFA, 0xF5, 0x24, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF9, 0x03, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xF9, 0x39, 0x00, 0x00, 0x00, 
+    0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC9, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x24, 0x00, 0x00, 
+    0x32, 0xFF, 0x50, 0x00, 0xBC, 0xCA, 0x00, 0x00, 0x00, 0x74, 0xE4, 0x00, 
+    0x00, 0x0A, 0xF6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF7, 0x56, 
+    0x00, 0x00, 0x04, 0xE4, 0x9C, 0x00, 0x0A, 0xF6, 0x73, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 
+    0x55, 0x00, 0x00, 0x03, 0xE2, 0x9C, 0x00, 0xBC, 0xAE, 0x00, 0x00, 0x00, 
+    0xA5, 0x9F, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 
+    0x88, 0x70, 0xEF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 0xBC, 
+    0x88, 0x00, 0x00, 0x00, 0xC4, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 
+    0xBC, 0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0x08, 0xF8, 0x5C, 0x00, 
+    0x00, 0x00, 0xCE, 0x90, 0x00, 0xBC, 0xCA, 0x00, 0x00, 0x00, 0x74, 0xE5, 
+    0x00, 0x00, 0x09, 0xF8, 0x56, 0x00, 0x00, 0x04, 0xE4, 0x9C, 0x00, 0xBC, 
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x8C, 
+    0x00, 0x00, 0xB4, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x85, 0x00, 0x00, 
+    0x00, 0xCF, 0x9C, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x6D, 0xE3, 0x02, 0x00, 
+    0x00, 0x00, 0x0C, 0xFB, 0xA0, 0xB5, 0x00, 0x41, 0xDB, 0xC5, 0x7B, 0x00, 
+    0x00, 0x00, 0x05, 0xCC, 0xA7, 0x70, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+    0x6C, 0xD9, 0x93, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFA, 0x42, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x87, 0xEB, 0x04, 0x00, 0x00, 0x00, 0x38, 
+    0xF0, 0x00, 0x00, 0x00, 0x12, 0xF8, 0x6F, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x7C, 0x00, 
+    0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xE0, 0x00, 0x00, 0x0A, 0x84, 0xDC, 0xF9, 0xC0, 0x62, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x06, 0xD3, 0x3D, 0x1F, 0xF4, 0x00, 0x00, 0x9E, 0x77, 
+    0x00, 0x0C, 0xFC, 0x4B, 0x00, 0x18, 0xCF, 0xC1, 0x0F, 0xA8, 0x96, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xC2, 0x91, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xB4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 
+    0xC9, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x6E, 0x00, 0x00, 0x00, 0x88, 0xDD, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
+    0xF3, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB6, 
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xA7, 0x00, 0x00, 0xE4, 0xB2, 0x00, 0x00, 
+    0x00, 0x72, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFB, 0x61, 0x00, 0x00, 
+    0x00, 0x02, 0xF6, 0x6F, 0x00, 0x00, 0x00, 0x87, 0xDF, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xAE, 0xC0, 0x00, 0x5C, 0xFF, 0x14, 0x00, 0x7D, 
+    0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x8D, 0xEA, 0xF2, 0x9C, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x38, 0xB6, 0xFC, 0xD5, 0x72, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x47, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x08, 0xEF, 0x00, 0x00, 0xD1, 
+    0x47, 0x00, 0x00, 0x40, 0xE8, 0x00, 0x3B, 0xCE, 0x00, 0x00, 0x00, 0x88, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1D, 0x00, 0x00, 0xA0, 0xC0, 0x00, 
+    0x00, 0x00, 0x00, 0xEB, 0x83, 0x00, 0x0D, 0xFB, 0x77, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xAF, 0xC8, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x76, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xAC, 0xB4, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+    0x3C, 0xFF, 0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 
+    0xA0, 0xC0, 0x16, 0xD3, 0xD4, 0x16, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB8, 0x00, 0x3C, 0xEA, 0xDF, 
+    0x4F, 0x00, 0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0x00, 0xA8, 0xC1, 0x3C, 
+    0xFF, 0x18, 0x00, 0x0D, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+    0xFC, 0x0F, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 
+    0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFB, 0x0D, 0x00, 0xA0, 
+    0xC0, 0x00, 0x07, 0x59, 0xF8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0xA0, 0xF5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xA9, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0xF8, 0x02, 0x00, 0x00, 0x00, 0x5D, 0xF8, 0x12, 0x7A, 0xEA, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x81, 0xA3, 0x00, 0x00, 0xC9, 
+    0x58, 0xA9, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF6, 0x5E, 0xB3, 
+    0xC5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0x63, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFB, 0x17, 0x00, 
+    0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEE, 0x86, 0x0B, 
+    0x2D, 0xCF, 0xFF, 0x50, 0x00, 0xBC, 0x96, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
+    0x0E, 0x00, 0x00, 0x85, 0xEA, 0x4D, 0x0D, 0x34, 0x97, 0x00, 0x2B, 0xFF, 
+    0x22, 0x00, 0x00, 0x00, 0xB3, 0x9C, 0x00, 0x00, 0x80, 0xF1, 0x59, 0x0E, 
+    0x1F, 0x69, 0x7C, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x94, 0xDA, 0x30, 0x12, 0x8B, 0xFF, 0x9C, 0x00, 0xBC, 0x89, 0x00, 0x00, 
+    0x00, 0x94, 0xB0, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 
+    0xBC, 0xE3, 0xF8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 0x00, 
+    0xBC, 0x88, 0x00, 0x00, 0x00, 0xC4, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x74, 
+    0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0x00, 0x8A, 0xE0, 
+    0x36, 0x10, 0x7D, 0xF8, 0x21, 0x00, 0xBC, 0xFF, 0x76, 0x0F, 0x3F, 0xEB, 
+    0x74, 0x00, 0x00, 0x00, 0x90, 0xDC, 0x31, 0x12, 0x90, 0xFF, 0x9C, 0x00, 
+    0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x38, 0x99, 0x2F, 0x08, 0x30, 0xE7, 
+    0x69, 0x00, 0x00, 0xB4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x82, 0xDF, 0x28, 
+    0x0F, 0x7A, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x42, 0xFB, 0xD5, 0x89, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xC9, 0xFC, 0x74, 0x00, 0x08, 0xF8, 0xFC, 0x3B, 
+    0x00, 0x00, 0x00, 0x88, 0xE2, 0x10, 0x01, 0xB8, 0xC1, 0x02, 0x00, 0x00, 
+    0x00, 0x10, 0xF7, 0xF9, 0x61, 0x00, 0x00, 0x00, 0x2C, 0xF5, 0x6C, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFA, 0x53, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFE, 0xFF, 0x28, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x7C, 
+    0x00, 0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x35, 0x00, 0xCB, 0x50, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x5B, 0xEB, 0x72, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x98, 0x00, 0x20, 0xF4, 0x00, 0x00, 0x9E, 
+    0x77, 0x00, 0x11, 0xFE, 0x56, 0x00, 0x00, 0x0D, 0xBC, 0xD9, 0xE9, 0x19, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x35, 
+    0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xB4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xAB, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xAF, 0x00, 0x00, 0x00, 0xCA, 
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+    0xF3, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 
+    0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xAC, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xE5, 0x8D, 0x00, 0x00, 0xA9, 0xB2, 0x00, 
+    0x00, 0x00, 0x73, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF1, 0x0B, 0x00, 
+    0x00, 0x00, 0x01, 0xF3, 0x6E, 0x00, 0x00, 0x00, 0x88, 0xDC, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x13, 0xF4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xC7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x53, 
+    0xB6, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x76, 0x9B, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x23, 0x00, 
+    0x88, 0xC1, 0x1B, 0x19, 0xBB, 0xE8, 0x33, 0xD5, 0x4C, 0x00, 0x00, 0x04, 
+    0xE7, 0x57, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x7E, 0x00, 0x00, 0xA0, 0xC0, 
+    0x00, 0x00, 0x00, 0x00, 0xEC, 0x88, 0x00, 0x00, 0xAF, 0xE1, 0x08, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0xF8, 0x76, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xDF, 0x07, 
+    0x00, 0x00, 0x00, 0x00, 0xAC, 0xB4, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 
+    0x00, 0x3C, 0xFF, 0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0xC0, 
+    0x00, 0xA0, 0xC0, 0x00, 0x14, 0xD0, 0xD5, 0x18, 0x00, 0x00, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB8, 0x00, 0x00, 0xD8, 
+    0xE8, 0x04, 0x00, 0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0x00, 0x23, 0xFA, 
+    0x88, 0xFF, 0x18, 0x00, 0x00, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x00, 0x04, 
+    0xDC, 0xB1, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x00, 0x04, 0xDC, 0xAC, 0x00, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x86, 0xE9, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xD6, 0x00, 0x00, 0x00, 
+    0x00, 0x97, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x6E, 0xDC, 0x8C, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0xC2, 0x63, 0x00, 0x00, 
+    0x8A, 0x9A, 0xE9, 0x77, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCD, 0xAA, 0x00, 
+    0x18, 0xED, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF9, 0x93, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x61, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xD5, 
+    0xF9, 0xE0, 0x71, 0xF4, 0x50, 0x00, 0xBC, 0x95, 0x00, 0x00, 0x00, 0x3F, 
+    0xFF, 0x0E, 0x00, 0x00, 0x01, 0x75, 0xDD, 0xF7, 0xC8, 0x3C, 0x00, 0x2B, 
+    0xFF, 0x21, 0x00, 0x00, 0x00, 0xB3, 0x9C, 0x00, 0x00, 0x00, 0x6A, 0xD5, 
+    0xF9, 0xDF, 0x93, 0x16, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0A, 0xA0, 0xF3, 0xE6, 0x9B, 0xB8, 0x95, 0x00, 0xBC, 0x88, 0x00, 
+    0x00, 0x00, 0x94, 0xB0, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 0x94, 
+    0x00, 0xBC, 0xAF, 0xE7, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x94, 
+    0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0xC4, 0x80, 0x00, 0x00, 0x00, 0xD0, 
+    0x74, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0x00, 0x06, 
+    0x8C, 0xE8, 0xF9, 0xCB, 0x42, 0x00, 0x00, 0xBC, 0x9D, 0xAA, 0xEA, 0xEE, 
+    0x8B, 0x03, 0x00, 0x00, 0x00, 0x09, 0x9D, 0xF3, 0xE6, 0x9B, 0xB0, 0x9C, 
+    0x00, 0xBC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0xD0, 0xF6, 0xDF, 
+    0x81, 0x02, 0x00, 0x00, 0xAF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA3, 
+    0xEF, 0xE4, 0x93, 0xB2, 0x9C, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xFF, 0x2D, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x34, 0x00, 0x00, 0xC0, 0xF5, 
+    0x05, 0x00, 0x00, 0x3F, 0xFB, 0x40, 0x00, 0x00, 0x18, 0xEA, 0x79, 0x00, 
+    0x00, 0x00, 0x00, 0xA4, 0xF3, 0x0B, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x90, 0xEA, 0x04, 0x00, 0x00, 
+    0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 0x11, 0xF7, 0x78, 0x09, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0xE4, 0x80, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF4, 0x04, 0x0B, 0xFA, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x91, 0xB3, 
+    0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0x0F, 0x00, 0x03, 0xE2, 0x5B, 0x1F, 
+    0xE8, 0x3B, 0x00, 0x00, 0xA9, 0xE4, 0x49, 0x0B, 0x1D, 0x80, 0xFD, 0xDF, 
+    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xDE, 0x00, 0x00, 0x00, 0x00, 
+    0x6B, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xB4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0xF1, 0x31, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFB, 0x5E, 0x11, 0x71, 
+    0xFB, 0x33, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x7B, 
+    0xF3, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x3C, 0x0D, 0x16, 0x71, 
+    0xFD, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xAC, 0x00, 0x00, 
+    0x00, 0xAB, 0x3E, 0x0D, 0x21, 0xA6, 0xF5, 0x27, 0x00, 0x00, 0x35, 0xF7, 
+    0x56, 0x0A, 0x35, 0xE2, 0x95, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x97, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA3, 0xE1, 0x37, 0x09, 0x41, 0xED, 0x8A, 0x00, 
+    0x00, 0x63, 0x59, 0x0D, 0x27, 0xBF, 0xCE, 0x07, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x54, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x88, 0x94, 
+    0x00, 0x0B, 0xA0, 0xF0, 0xDA, 0x6F, 0xE8, 0xB5, 0x35, 0x00, 0x00, 0x00, 
+    0x4F, 0xF9, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x71, 0xE0, 0x02, 0x00, 0xA0, 
+    0xC0, 0x00, 0x00, 0x11, 0x7F, 0xFC, 0x3A, 0x00, 0x00, 0x1D, 0xE3, 0xBE, 
+    0x37, 0x07, 0x18, 0x48, 0xBC, 0x03, 0x00, 0xA0, 0xC0, 0x00, 0x02, 0x17, 
+    0x59, 0xE0, 0xC5, 0x09, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xE3, 
+    0xC9, 0x42, 0x13, 0x0A, 0x31, 0xCF, 0xB3, 0x00, 0xA0, 0xC0, 0x00, 0x00, 
+    0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0xA0, 
+    0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x12, 0xCD, 0xD8, 0x19, 0x00, 0x00, 
+    0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB8, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0x00, 0x00, 
+    0x94, 0xF7, 0xFF, 0x18, 0x00, 0x00, 0x1E, 0xE6, 0xB7, 0x2B, 0x05, 0x28, 
+    0xB2, 0xE6, 0x1E, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1E, 0xE6, 0xB7, 0x2B, 0x05, 0x28, 0xB2, 0xE6, 0x1B, 0x00, 
+    0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0xEA, 0x83, 0x00, 0x00, 0x07, 
+    0xC1, 0x52, 0x1C, 0x09, 0x38, 0xD6, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF9, 0x84, 0x17, 
+    0x0E, 0x57, 0xF6, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xEE, 0xFF, 
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF9, 0xF9, 0x23, 0x00, 
+    0x00, 0x4B, 0xF2, 0xFF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x87, 0xE4, 0x11, 
+    0x00, 0x00, 0x59, 0xF8, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xE7, 0xBF, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 
+    0xAD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xCA, 0x00, 0x00, 0x00, 
+    0x74, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0xF8, 0x56, 0x00, 0x00, 0x04, 0xE4, 0x9C, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD9, 0x74, 0x00, 0xBC, 0x88, 
+    0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0xB0, 
+    0x94, 0x00, 0xBC, 0x88, 0x29, 0xE8, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB0, 
+    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x88, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 
+    0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xC2, 0x0C, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xBA, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x1E, 0x00, 
+    0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x13, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0xE4, 0x80, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xBD, 0x00, 0x42, 
+    0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x51, 0x17, 0xB2, 0x36, 0xDE, 
+    0x7A, 0x00, 0x00, 0x00, 0x01, 0xC4, 0x51, 0x00, 0x00, 0x00, 0x40, 0xDA, 
+    0xED, 0x80, 0x00, 0x00, 0x00, 0x07, 0x79, 0xD8, 0xF8, 0xE8, 0xA1, 0x27, 
+    0xAE, 0xDD, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF9, 0x2A, 0x00, 0x00, 
+    0x00, 0xB6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x43, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xDB, 0xF9, 
+    0xD4, 0x4E, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3D, 0xB9, 0xF0, 0xEB, 
+    0xC0, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xAC, 0x00, 
+    0x00, 0x00, 0x3B, 0xB9, 0xF0, 0xE6, 0xB0, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+    0x4B, 0xD1, 0xF8, 0xDF, 0x86, 0x08, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x32, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x8F, 0xE0, 0xF7, 0xDC, 0x83, 0x07, 
+    0x00, 0x00, 0x13, 0xA0, 0xF0, 0xE9, 0x97, 0x11, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0xDE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB2, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x46, 0x00, 
+    0xA0, 0xFF, 0xFF, 0xFF, 0xF1, 0xC8, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x16, 
+    0x90, 0xDD, 0xF9, 0xE5, 0xB4, 0x41, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFC, 
+    0xEB, 0xBF, 0x6B, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xF4, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x15, 0x8D, 0xDA, 0xF8, 0xED, 0xCD, 0x82, 0x18, 0x00, 0xA0, 0xC0, 0x00, 
+    0x00, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 
+    0xA1, 0xBD, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x10, 0xCA, 0xDA, 0x1B, 
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xB8, 0x00, 0xA0, 0xB8, 0x00, 0x00, 
+    0x00, 0x16, 0xF2, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x1A, 0x99, 0xE5, 0xFB, 
+    0xE6, 0x9B, 0x1B, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x99, 0xE5, 0xFD, 0xFF, 0xC4, 0x16, 0x00, 
+    0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xF5, 0x19, 0x00, 
+    0x00, 0x3D, 0xAA, 0xE3, 0xF6, 0xDD, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xBA, 
+    0xE9, 0xF2, 0xCC, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 
+    0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE3, 0x00, 
+    0x00, 0x00, 0x0F, 0xFC, 0xF1, 0x03, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x43, 
+    0x00, 0x00, 0x00, 0x00, 0xAB, 0xCC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2F, 0xF2, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x76, 0x0F, 
+    0x3F, 0xEB, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x90, 0xDC, 0x31, 0x12, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xCC, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x42, 0x6A, 0x15, 0x18, 0x8D, 0xF6, 0x1E, 0x00, 0xBC, 
+    0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 
+    0xB0, 0x94, 0x00, 0xBC, 0x88, 0x00, 0x29, 0xE8, 0x90, 0x00, 0x00, 0x00, 
+    0xB0, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x88, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xA4, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xC4, 0xF5, 0xFF, 0x28, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x42, 0xFD, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x24, 
+    0x00, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x08, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x4C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA9, 0xE7, 0xFD, 0xD9, 
+    0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x91, 0x00, 
+    0x00, 0x1E, 0xF4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x8F, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x27, 0xD9, 0xA6, 0x3E, 0x0D, 0x0F, 0x34, 0x92, 0xA8, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB4, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xF2, 0x27, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xE2, 0x45, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x9D, 0xAA, 
+    0xEA, 0xEE, 0x8B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x09, 0x9D, 0xF3, 0xE6, 0x9B, 0xB0, 0x9C, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xCC, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x91, 0xE4, 0xEF, 0xC0, 0x36, 0x00, 0x00, 
+    0xBC, 0x88, 0x00, 0x00, 0x00, 0x94, 0xB0, 0x00, 0xB0, 0x94, 0x00, 0x00, 
+    0x00, 0xB0, 0x94, 0x00, 0xBC, 0x88, 0x00, 0x00, 0x2A, 0xE9, 0x8F, 0x00, 
+    0x00, 0xB0, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x88, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xA4, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xE4, 0xF1, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 
+    0x27, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x04, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x4C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xB4, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEA, 
+    0x1C, 0x00, 0x9C, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xDA, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0A, 0x73, 0xC9, 0xF3, 0xF3, 0xD4, 0x99, 0x33, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x34, 0xF4, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC4, 
+    0xD5, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0x1C, 0x00, 
+    0x00, 0x00, 0x00, 0x96, 0x91, 0x00, 0xA4, 0xFF, 0xFF, 0x44, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xB5, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+    0xF9, 0x6C, 0x05, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x06, 0x82, 0xE5, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xB7, 0xE6, 0x8E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x16, 0xE4, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x6E, 0xE5, 0xFD, 0x28, 0x00, 0x38, 0xF0, 0x00, 0x40, 0xFC, 0xE0, 
+    0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x40, 0xF4, 0xAB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 
+};
+
+static constexpr PrebakedFont DejaVuSans_ttf_14 = {
+    DejaVuSans_ttf, 757076, 14, 10, 805, 15, DejaVuSans_ttf_14_pixels, {
+        {4, 0, 10, 0, 0, 0, 0},
+        {6, 2, 0, 2, 10, 1, 0},
+        {6, 1, 0, 5, 4, 4, 0},
+        {12, 1, 0, 10, 10, 10, 0},
+        {9, 1, -1, 7, 13, 21, 0},
+        {13, 0, 0, 13, 10, 29, 0},
+        {11, 0, 0, 11, 10, 43, 0},
+        {4, 1, 0, 2, 4, 55, 0},
+        {5, 1, -1, 4, 12, 58, 0},
+        {5, 1, -1, 4, 12, 63, 0},
+        {7, 0, 0, 7, 6, 68, 0},
+        {12, 1, 1, 10, 9, 76, 0},
+        {4, 1, 8, 3, 3, 87, 0},
+        {5, 0, 6, 5, 1, 91, 0},
+        {4, 1, 8, 2, 2, 97, 0},
+        {5, 0, 0, 5, 12, 100, 0},
+        {9, 0, 0, 8, 10, 106, 0},
+        {9, 1, 0, 7, 10, 115, 0},
+        {9, 1, 0, 7, 10, 123, 0},
+        {9, 1, 0, 7, 10, 131, 0},
+        {9, 0, 0, 9, 10, 139, 0},
+        {9, 1, 0, 7, 10, 149, 0},
+        {9, 0, 0, 9, 10, 157, 0},
+        {9, 1, 0, 7, 10, 167, 0},
+        {9, 0, 0, 8, 10, 175, 0},
+        {9, 0, 0, 8, 10, 184, 0},
+        {5, 1, 3, 3, 7, 193, 0},
+        {5, 1, 3, 3, 8, 197, 0},
+        {12, 1, 2, 10, 8, 201, 0},
+        {12, 1, 3, 10, 4, 212, 0},
+        {12, 1, 2, 10, 8, 223, 0},
+        {7, 1, 0, 6, 10, 234, 0},
+        {14, 0, 0, 14, 12, 241, 0},
+        {10, 0, 0, 10, 10, 256, 0},
+        {10, 1, 0, 8, 10, 267, 0},
+        {10, 0, 0, 10, 10, 276, 0},
+        {11, 1, 0, 9, 10, 287, 0},
+        {9, 1, 0, 7, 10, 297, 0},
+        {8, 1, 0, 7, 10, 305, 0},
+        {11, 0, 0, 10, 10, 313, 0},
+        {11, 1, 0, 9, 10, 324, 0},
+        {4, 1, 0, 2, 10, 334, 0},
+        {4, -1, 0, 4, 13, 337, 0},
+        {9, 1, 0, 9, 10, 342, 0},
+        {8, 1, 0, 7, 10, 352, 0},
+        {12, 1, 0, 10, 10, 360, 0},
+        {10, 1, 0, 9, 10, 371, 0},
+        {11, 0, 0, 11, 10, 381, 0},
+        {8, 1, 0, 7, 10, 393, 0},
+        {11, 0, 0, 11, 12, 401, 0},
+        {10, 1, 0, 9, 10, 413, 0},
+        {9, 0, 0, 9, 10, 423, 0},
+        {9, -1, 0, 10, 10, 433, 0},
+        {10, 1, 0, 9, 10, 444, 0},
+        {10, 0, 0, 10, 10, 454, 0},
+        {14, 0, 0, 14, 10, 465, 0},
+        {10, 0, 0, 10, 10, 480, 0},
+        {9, -1, 0, 10, 10, 491, 0},
+        {10, 0, 0, 9, 10, 502, 0},
+        {5, 1, -1, 4, 12, 512, 0},
+        {5, 0, 0, 5, 12, 517, 0},
+        {5, 1, -1, 4, 12, 523, 0},
+        {12, 1, 0, 10, 4, 528, 0},
+        {7, -1, 12, 9, 1, 539, 0},
+        {7, 1, -1, 4, 3, 549, 0},
+        {9, 0, 2, 8, 8, 554, 0},
+        {9, 1, -1, 8, 11, 563, 0},
+        {8, 0, 2, 7, 8, 572, 0},
+        {9, 0, -1, 8, 11, 580, 0},
+        {9, 0, 2, 8, 8, 589, 0},
+        {5, 0, -1, 6, 11, 598, 0},
+        {9, 0, 2, 8, 11, 605, 0},
+        {9, 1, -1, 7, 11, 614, 0},
+        {4, 1, -1, 2, 11, 622, 0},
+        {4, -1, -1, 4, 14, 625, 0},
+        {8, 1, -1, 8, 11, 630, 0},
+        {4, 1, -1, 2, 11, 639, 0},
+        {14, 1, 2, 12, 8, 642, 0},
+        {9, 1, 2, 7, 8, 655, 0},
+        {9, 0, 2, 8, 8, 663, 0},
+        {9, 1, 2, 8, 11, 672, 0},
+        {9, 0, 2, 8, 11, 681, 0},
+        {6, 1, 2, 5, 8, 690, 0},
+        {7, 0, 2, 7, 8, 696, 0},
+        {5, 0, 0, 6, 10, 704, 0},
+        {9, 1, 2, 7, 8, 711, 0},
+        {8, 0, 2, 8, 8, 719, 0},
+        {11, 0, 2, 11, 8, 728, 0},
+        {8, 0, 2, 8, 8, 740, 0},
+        {8, 0, 2, 8, 11, 749, 0},
+        {7, 0, 2, 7, 8, 758, 0},
+        {9, 1, -1, 7, 13, 766, 0},
+        {5, 1, -1, 2, 14, 774, 0},
+        {9, 1, -1, 7, 13, 777, 0},
+        {12, 1, 4, 10, 4, 785, 0},
+        {8, 0, 0, 8, 12, 796, 0},
+    }
+};
+
+static constexpr const PrebakedFont *FONTS[] = {&DejaVuSans_ttf_14};
+
+const PrebakedFont* PrebakedFont::find(const unsigned char *data, signed long length, unsigned int pixel_size) {
+    for (const PrebakedFont *font : FONTS) {
+        if (font->data == data && (signed long)font->length == length && font->pixel_size == pixel_size) {
+            return font;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <vector>
+
+#include <SDL.h>
+
+#include "program_cache.hpp"
+
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    #define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+static PFNGLGETPROGRAMBINARYPROC getProgramBinary = nullptr;
+static PFNGLPROGRAMBINARYPROC programBinary = nullptr;
+static PFNGLPROGRAMPARAMETERIPROC programParameteri = nullptr;
+
+ProgramCache::Stats ProgramCache::stats;
+
+bool ProgramCache::supported() {
+    if (!programBinary && SDL_GL_ExtensionSupported("GL_ARB_get_program_binary")) {
+        getProgramBinary = (PFNGLGETPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glGetProgramBinary");
+        programBinary = (PFNGLPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glProgramBinary");
+        programParameteri = (PFNGLPROGRAMPARAMETERIPROC)SDL_GL_GetProcAddress("glProgramParameteri");
+        if (!getProgramBinary || !programParameteri) { programBinary = nullptr; }
+    }
+    return programBinary != nullptr;
+}
+
+static void hash(uint64_t &hash, const char *text) {
+    if (!text) { return; }
+    for (; *text; text++) {
+        hash = (hash ^ (unsigned char)*text) * 1099511628211ull;
+    }
+    // Separates the strings so that moving text between them changes the hash.
+    hash = (hash ^ 0xff) * 1099511628211ull;
+}
+
+std::string ProgramCache::path(const char *vertex_shader, const char *fragment_shader) {
+    uint64_t key = 14695981039346656037ull;
+    hash(key, (const char*)glGetString(GL_VENDOR));
+    hash(key, (const char*)glGetString(GL_RENDERER));
+    hash(key, (const char*)glGetString(GL_VERSION));
+    hash(key, vertex_shader);
+    hash(key, fragment_shader);
+
+    char *directory = SDL_GetPrefPath("Agro", "program_cache");
+    if (!directory) { return ""; }
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    std::string path = std::string(directory) + name;
+    SDL_free(directory);
+    return path;
+}
+
+bool ProgramCache::load(unsigned int program, const char *vertex_shader, const char *fragment_shader) {
+    if (!supported()) { return false; }
+    uint64_t start = SDL_GetPerformanceCounter();
+    std::string file_path = path(vertex_shader, fragment_shader);
+    FILE *file = file_path.size() ? fopen(file_path.c_str(), "rb") : nullptr;
+    bool linked = false;
+    if (file) {
+        GLenum format;
+        std::vector<unsigned char> binary;
+        if (fread(&format, sizeof(format), 1, file) == 1) {
+            fseek(file, 0, SEEK_END);
+            long length = ftell(file) - (long)sizeof(format);
+            fseek(file, sizeof(format), SEEK_SET);
+            if (length > 0) {
+                binary.resize(length);
+                if (fread(binary.data(), 1, length, file) == (size_t)length) {
+                    programBinary(program, format, binary.data(), length);
+                    int success = 0;
+                    glGetProgramiv(program, GL_LINK_STATUS, &success);
+                    linked = success;
+                }
+            }
+        }
+        fclose(file);
+    }
+    if (linked) {
+        stats.hits++;
+        stats.load_ms += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    } else {
+        stats.misses++;
+    }
+    return linked;
+}
+
+void ProgramCache::prepare(unsigned int program) {
+    if (supported()) {
+        programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+void ProgramCache::store(unsigned int program, const char *vertex_shader, const char *fragment_shader) {
+    if (!supported()) { return; }
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) { return; }
+    std::vector<unsigned char> binary(length);
+    GLenum format;
+    getProgramBinary(program, length, &length, &format, binary.data());
+
+    std::string file_path = path(vertex_shader, fragment_shader);
+    FILE *file = file_path.size() ? fopen(file_path.c_str(), "wb") : nullptr;
+    if (!file) { return; }
+    fwrite(&format, sizeof(format), 1, file);
+    fwrite(binary.data(), 1, length, file);
+    fclose(file);
+}
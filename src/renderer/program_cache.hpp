@@ -0,0 +1,42 @@
+#ifndef PROGRAM_CACHE_HPP
+    #define PROGRAM_CACHE_HPP
+
+    #include <string>
+    #include <cstdint>
+
+    #include "glad.h"
+
+    /// On disk cache of linked shader programs.
+    /// Programs are stored with `glGetProgramBinary` under the SDL preference
+    /// path and keyed by a hash of the driver vendor, renderer, version
+    /// and the shader sources, so a driver update simply misses the cache.
+    /// The entry points come from `ARB_get_program_binary` which is loaded
+    /// at runtime since glad is generated for GL 3.3 core, when it's missing
+    /// every lookup is a miss and Shader compiles from source as before.
+    struct ProgramCache {
+        struct Stats {
+            int hits = 0;
+            int misses = 0;
+            /// Time spent loading cached binaries.
+            double load_ms = 0.0;
+            /// Time spent compiling and linking from source.
+            double compile_ms = 0.0;
+        };
+
+        static Stats stats;
+
+        static bool supported();
+
+        /// Tries to link `program` from a cached binary,
+        /// returns false when there is no usable entry.
+        static bool load(unsigned int program, const char *vertex_shader, const char *fragment_shader);
+
+        /// Must be called before linking a program that will be stored.
+        static void prepare(unsigned int program);
+
+        static void store(unsigned int program, const char *vertex_shader, const char *fragment_shader);
+
+        private:
+            static std::string path(const char *vertex_shader, const char *fragment_shader);
+    };
+#endif
@@ -0,0 +1,154 @@
+#include <cstring>
+
+#include "quad_list.hpp"
+
+void QuadList::clear() {
+    quads.clear();
+    clips.clear();
+    sources.clear();
+    culled = 0;
+    trimmed = 0;
+}
+
+void QuadList::build(
+    const DrawList &list, const DrawList::Command *begin, const DrawList::Command *end,
+    Rect clip, Option<Rect> damage, bool use_layers, Point offset
+) {
+    clear();
+    setClip(clip, damage);
+    for (const DrawList::Command *command = begin; command != end; command = list.next(command)) {
+        switch (command->type) {
+            case DrawList::Type::FillRect: {
+                const DrawList::FillRectCommand *c = (const DrawList::FillRectCommand*)command;
+                fillRectWithGradient(Rect(c->rect.x + offset.x, c->rect.y + offset.y, c->rect.w, c->rect.h), c->color, c->color, Gradient::TopToBottom);
+                break;
+            }
+            case DrawList::Type::FillRectWithGradient: {
+                const DrawList::FillRectWithGradientCommand *c = (const DrawList::FillRectWithGradientCommand*)command;
+                fillRectWithGradient(Rect(c->rect.x + offset.x, c->rect.y + offset.y, c->rect.w, c->rect.h), c->from_color, c->to_color, c->orientation);
+                break;
+            }
+            case DrawList::Type::FillText: {
+                const DrawList::FillTextCommand *c = (const DrawList::FillTextCommand*)command;
+                fillText(c, Point(c->point.x + offset.x, c->point.y + offset.y));
+                break;
+            }
+            case DrawList::Type::DrawTexture: {
+                const DrawList::DrawTextureCommand *c = (const DrawList::DrawTextureCommand*)command;
+                drawTexture(c, Point(c->point.x + offset.x, c->point.y + offset.y), use_layers);
+                break;
+            }
+            case DrawList::Type::SetClip: {
+                const DrawList::SetClipCommand *c = (const DrawList::SetClipCommand*)command;
+                setClip(Rect(c->rect.x + offset.x, c->rect.y + offset.y, c->rect.w, c->rect.h), damage);
+                break;
+            }
+        }
+    }
+}
+
+void QuadList::setClip(Rect rect, Option<Rect> damage) {
+    if (damage) { rect = rect.clipTo(damage.value); }
+    clips.push_back(rect);
+}
+
+uint16_t QuadList::source(unsigned int ID, Renderer::Sampler sampler) {
+    if (sources.size() && sources.back().ID == ID && sources.back().sampler == sampler) {
+        return sources.size() - 1;
+    }
+    sources.push_back(Source{ID, sampler});
+    return sources.size() - 1;
+}
+
+void QuadList::push(Renderer::Instance instance, uint16_t source, bool is_clipped) {
+    quads.push_back(Quad{instance, (uint16_t)(clips.size() - 1), source, is_clipped});
+}
+
+// Mirrors Renderer::fillRectWithGradient().
+void QuadList::fillRectWithGradient(Rect rect, Color from_color, Color to_color, Gradient orientation) {
+    Rect clip = clips.back();
+    switch (Renderer::clipTest(rect, clip)) {
+        case Renderer::ClipTest::Outside:
+            culled++;
+            return;
+        case Renderer::ClipTest::Partial:
+            Renderer::trimRect(rect, from_color, to_color, orientation, clip);
+            trimmed++;
+            break;
+        case Renderer::ClipTest::Inside:
+            break;
+    }
+    uint8_t flags = orientation == Gradient::LeftToRight ? Renderer::Instance::HORIZONTAL_GRADIENT : 0;
+    push(
+        Renderer::packInstance(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, 0.0, 0.0, 0.0, 0.0, from_color, to_color, 0, Renderer::Sampler::Color, NO_CLIP_INDEX, flags),
+        NO_SOURCE,
+        false
+    );
+}
+
+// Mirrors the scalar path of Renderer::fillText(). Workers lay their text out
+// themselves since the TextRunCache of the renderer is not thread safe,
+// the glyphs have been prepared on the main thread by DrawList::replay().
+void QuadList::fillText(const DrawList::FillTextCommand *command, Point point) {
+    Renderer::Selection selection = command->selection;
+    if (selection.begin > selection.end) {
+        auto temp = selection.end;
+        selection.end = selection.begin;
+        selection.begin = temp;
+    }
+
+    Rect clip = clips.back();
+    Renderer::Sampler sampler = Renderer::textSampler(command->font);
+    m_run.layout(command->font, command->text(), command->tab_width, command->is_multiline, command->line_spacing);
+    for (size_t i = 0; i < m_run.count(); i++) {
+        int xpos = point.x + m_run.x[i];
+        int ypos = point.y + m_run.y[i];
+        int w = m_run.width[i];
+        int h = m_run.height[i];
+        Renderer::ClipTest test = Renderer::clipTest(Rect(xpos, ypos, w, h), clip);
+        if (test == Renderer::ClipTest::Outside) {
+            culled++;
+            continue;
+        }
+        Color color = command->color;
+        if (selection.begin != selection.end && (m_run.index[i] >= selection.begin && m_run.index[i] < selection.end)) { color = command->selection_color; }
+        Renderer::Instance instance = Renderer::packInstance(xpos, ypos, xpos + w, ypos + h, 0.0, 0.0, 0.0, 0.0, color, color, 0, sampler, NO_CLIP_INDEX);
+        memcpy(&instance.texture_uv[0], &m_run.uv_bottom_left[i], sizeof(uint32_t));
+        memcpy(&instance.texture_uv[2], &m_run.uv_top_right[i], sizeof(uint32_t));
+        push(instance, source(m_run.texture[i], sampler), test == Renderer::ClipTest::Partial);
+    }
+}
+
+// Mirrors Renderer::drawTexture().
+void QuadList::drawTexture(const DrawList::DrawTextureCommand *command, Point point, bool use_layers) {
+    Size size = command->size;
+    Renderer::ClipTest test = Renderer::clipTest(Rect(point.x, point.y, size.w, size.h), clips.back());
+    if (test == Renderer::ClipTest::Outside) {
+        culled++;
+        return;
+    }
+
+    Texture *texture = command->texture;
+    const TextureCoordinates &coords = command->coords;
+    int layer = 0;
+    uint16_t index = NO_SOURCE;
+    Renderer::Sampler sampler = Renderer::Sampler::Texture;
+    if (use_layers && texture->layer >= 0) {
+        layer = texture->layer;
+        sampler = Renderer::Sampler::Layer;
+    } else {
+        index = source(texture->ID, Renderer::Sampler::Texture);
+    }
+
+    uint8_t flags = coords.top_left.x != coords.bottom_left.x ? Renderer::Instance::SWAP_UV : 0;
+    push(
+        Renderer::packInstance(
+            point.x, point.y, point.x + size.w, point.y + size.h,
+            texture->mapU(coords.bottom_left.x), texture->mapV(coords.bottom_left.y),
+            texture->mapU(coords.top_right.x), texture->mapV(coords.top_right.y),
+            command->color, command->color, layer, sampler, NO_CLIP_INDEX, flags
+        ),
+        index,
+        test == Renderer::ClipTest::Partial
+    );
+}
@@ -0,0 +1,76 @@
+#ifndef QUAD_LIST_HPP
+    #define QUAD_LIST_HPP
+
+    #include <vector>
+    #include <cstdint>
+
+    #include "../option.hpp"
+
+    #include "../common/color.hpp"
+    #include "../common/rect.hpp"
+    #include "../common/size.hpp"
+    #include "../common/point.hpp"
+
+    #include "renderer.hpp"
+    #include "draw_list.hpp"
+
+    // Lists shorter than this get replayed on the calling thread.
+    #define QUAD_LIST_MIN_COMMANDS 512
+
+    /// The quads of a range of DrawList commands, generated without
+    /// touching the Renderer so that ranges can be built on worker threads.
+    /// Everything that depends on the state of the current batch, texture
+    /// slots and clip table entries, is kept as an index into the lists
+    /// of the QuadList and gets resolved by Renderer::submit().
+    struct QuadList {
+        struct Source {
+            unsigned int ID;
+            Renderer::Sampler sampler;
+        };
+
+        struct Quad {
+            /// Quads are kept in the Mode::Instanced layout, `texture_index`
+            /// only holds the layer for Sampler::Layer and `clip_index`
+            /// gets filled in by submit().
+            Renderer::Instance instance;
+            /// The clip in effect, an index into `clips`.
+            uint16_t clip;
+            /// Index into `sources`, NO_SOURCE for quads without a texture
+            /// to bind.
+            uint16_t source;
+            /// Whether the quad reaches outside of its clip and has
+            /// to be clipped on the GPU.
+            bool is_clipped;
+        };
+
+        static const uint16_t NO_SOURCE = UINT16_MAX;
+
+        std::vector<Quad> quads;
+        /// The first clip is the one the range started with,
+        /// the last one is in effect at its end.
+        std::vector<Rect> clips;
+        std::vector<Source> sources;
+        uint64_t culled = 0;
+        uint64_t trimmed = 0;
+
+        void clear();
+
+        /// Generates the quads for the commands from `begin` up to, but not
+        /// including, `end` moved by `offset`. `clip` is the clip in effect
+        /// at `begin`, the rest mirrors the Renderer the quads are meant for.
+        void build(
+            const DrawList &list, const DrawList::Command *begin, const DrawList::Command *end,
+            Rect clip, Option<Rect> damage, bool use_layers, Point offset = Point()
+        );
+
+        private:
+            TextRun m_run;
+
+            void setClip(Rect rect, Option<Rect> damage);
+            void fillRectWithGradient(Rect rect, Color from_color, Color to_color, Gradient orientation);
+            void fillText(const DrawList::FillTextCommand *command, Point point);
+            void drawTexture(const DrawList::DrawTextureCommand *command, Point point, bool use_layers);
+            uint16_t source(unsigned int ID, Renderer::Sampler sampler);
+            void push(Renderer::Instance instance, uint16_t source, bool is_clipped);
+    };
+#endif
@@ -1,59 +1,205 @@
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include <SDL.h>
+#ifdef AGRO_SSE2
+    #include <emmintrin.h>
+#endif
+
 #include "renderer.hpp"
-#include "../application.hpp"
+#include "quad_list.hpp"
+
+#define STRINGIFY(x) #x
+#define TO_STRING(x) STRINGIFY(x)
+#define MAX_CLIP_RECTS_STRING TO_STRING(MAX_CLIP_RECTS)
+
+static const char *vertex_shader =
+    "#version 330 core\n"
+    "layout (location = 0) in vec2 a_position;\n"
+    "layout (location = 1) in vec2 a_texture_uv;\n"
+    "layout (location = 2) in vec4 a_color;\n"
+    "layout (location = 3) in uint a_texture_slot_index;\n"
+    "layout (location = 4) in uint a_sampler_type;\n"
+    "layout (location = 5) in uint a_clip_index;\n"
+    "\n"
+    "out vec2 v_texture_uv;\n"
+    "out vec4 v_color;\n"
+    "flat out uint v_texture_slot_index;\n"
+    "flat out uint v_sampler_type;\n"
+    "flat out vec4 v_clip_rect;\n"
+    "\n"
+    "uniform mat4 u_projection;\n"
+    "layout (std140) uniform ClipRects {\n"
+    "    ivec4 u_clip_rects[" MAX_CLIP_RECTS_STRING "];\n"
+    "};\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+        "gl_Position = u_projection * vec4(a_position, 0.0, 1.0);\n"
+        "v_texture_uv = a_texture_uv;\n"
+        "v_color = a_color;\n"
+        "v_texture_slot_index = a_texture_slot_index;\n"
+        "v_sampler_type = a_sampler_type;\n"
+        "v_clip_rect = vec4(u_clip_rects[a_clip_index]);\n"
+    "}";
+
+static const char *instanced_vertex_shader =
+    "#version 330 core\n"
+    "layout (location = 0) in vec2 a_corner;\n"
+    "layout (location = 1) in vec4 a_rect;\n"
+    "layout (location = 2) in vec4 a_texture_uv;\n"
+    "layout (location = 3) in uint a_clip_index;\n"
+    "layout (location = 4) in vec4 a_color;\n"
+    "layout (location = 5) in vec4 a_to_color;\n"
+    "layout (location = 6) in uint a_texture_slot_index;\n"
+    "layout (location = 7) in uint a_sampler_type;\n"
+    "layout (location = 8) in uint a_flags;\n"
+    "\n"
+    "out vec2 v_texture_uv;\n"
+    "out vec4 v_color;\n"
+    "flat out uint v_texture_slot_index;\n"
+    "flat out uint v_sampler_type;\n"
+    "flat out vec4 v_clip_rect;\n"
+    "\n"
+    "uniform mat4 u_projection;\n"
+    "layout (std140) uniform ClipRects {\n"
+    "    ivec4 u_clip_rects[" MAX_CLIP_RECTS_STRING "];\n"
+    "};\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+        "gl_Position = u_projection * vec4(mix(a_rect.xy, a_rect.zw, a_corner), 0.0, 1.0);\n"
+        "vec2 uv_corner = (a_flags & 2u) != 0u ? a_corner.yx : a_corner;\n"
+        "v_texture_uv = mix(a_texture_uv.xy, a_texture_uv.zw, uv_corner);\n"
+        "v_color = mix(a_color, a_to_color, (a_flags & 1u) != 0u ? a_corner.x : a_corner.y);\n"
+        "v_texture_slot_index = a_texture_slot_index;\n"
+        "v_sampler_type = a_sampler_type;\n"
+        "v_clip_rect = vec4(u_clip_rects[a_clip_index]);\n"
+    "}";
+
+Renderer::Renderer() {
+    vertex_stream = new StreamBuffer(sizeof(Vertex) * BATCH_SEGMENT_SIZE * QUAD_VERTEX_COUNT);
+    instance_stream = new StreamBuffer(sizeof(Instance) * BATCH_SEGMENT_SIZE);
 
-Renderer::Renderer(unsigned int *indices) {
     glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
     glGenBuffers(1, &EBO);
 
     glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * MAX_BATCH_SIZE * QUAD_VERTEX_COUNT, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_stream->ID);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * MAX_BATCH_SIZE * QUAD_INDEX_COUNT, indices, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
     glEnableVertexAttribArray(0);
 
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texture_uv));
+    glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, texture_uv));
     glEnableVertexAttribArray(1);
 
-    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
     glEnableVertexAttribArray(2);
 
-    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texture_index));
+    glVertexAttribIPointer(3, 1, GL_UNSIGNED_BYTE, sizeof(Vertex), (void*)offsetof(Vertex, texture_index));
     glEnableVertexAttribArray(3);
 
-    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, is_text));
+    glVertexAttribIPointer(4, 1, GL_UNSIGNED_BYTE, sizeof(Vertex), (void*)offsetof(Vertex, sampler));
     glEnableVertexAttribArray(4);
 
-    glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, rect));
+    glVertexAttribIPointer(5, 1, GL_UNSIGNED_SHORT, sizeof(Vertex), (void*)offsetof(Vertex, clip_index));
     glEnableVertexAttribArray(5);
 
-    glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, clip_rect));
-    glEnableVertexAttribArray(6);
+    // The instanced path uses a shared unit quad drawn as a triangle strip
+    // and gets everything else from a per-instance record.
+    const float unit_quad[] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0
+    };
+    glGenVertexArrays(1, &instanced_VAO);
+    glGenBuffers(1, &unit_quad_VBO);
+
+    glBindVertexArray(instanced_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, unit_quad_VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(unit_quad), unit_quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    bindInstanceAttributes(0);
+    for (unsigned int i = 1; i <= 8; i++) {
+        glVertexAttribDivisor(i, 1);
+        glEnableVertexAttribArray(i);
+    }
+
+    static_assert(sizeof(Rect) == 4 * sizeof(int), "Rect has to match the std140 layout of ivec4");
+    glGenBuffers(1, &clip_UBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, clip_UBO);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(Rect) * MAX_CLIP_RECTS, nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, clip_UBO);
 
     glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &max_texture_slots);
+    if (max_texture_slots > MAX_TEXTURE_SLOTS) { max_texture_slots = MAX_TEXTURE_SLOTS; }
+    backend = chooseBackend();
+    const char *workers = SDL_getenv("AGRO_RENDERER_WORKERS");
+    if (workers) { setWorkerCount(atoi(workers)); }
 
+    reset();
+}
+
+std::string Renderer::fragmentShader(ClipMode clip_mode) {
     std::string fragment_shader = "#version 330 core\n";
         fragment_shader += "layout (origin_upper_left) in vec4 gl_FragCoord;\n";
         fragment_shader += "in vec2 v_texture_uv;\n";
         fragment_shader += "in vec4 v_color;\n";
-        fragment_shader += "in float v_texture_slot_index;\n";
-        fragment_shader += "in float v_sampler_type;\n";
-        fragment_shader += "in vec4 v_clip_rect;\n";
+        fragment_shader += "flat in uint v_texture_slot_index;\n";
+        fragment_shader += "flat in uint v_sampler_type;\n";
+        fragment_shader += "flat in vec4 v_clip_rect;\n";
         fragment_shader += "\n";
         fragment_shader += "out vec4 f_color;\n";
         fragment_shader += "\n";
+    if (backend == Backend::Array) {
+        fragment_shader += "uniform sampler2D u_texture;\n";
+        fragment_shader += "uniform sampler2D u_text;\n";
+        fragment_shader += "uniform sampler2DArray u_layers;\n";
+    } else {
         fragment_shader += "uniform sampler2D textures[" + std::to_string(max_texture_slots) + "];\n";
+    }
+        fragment_shader += "\n";
+        // Distances of 0.5 lie on the outline, the edge gets smoothed over
+        // about a pixel whatever the scale. Sampler types are flat per quad
+        // so the derivatives stay well defined inside of the switch.
+        fragment_shader += "float coverage(float field) {\n";
+        fragment_shader += "float edge = max(fwidth(field) * 0.75, 0.001);\n";
+        fragment_shader += "return smoothstep(0.5 - edge, 0.5 + edge, field);\n";
+        fragment_shader += "}\n";
         fragment_shader += "\n";
         fragment_shader += "void main()\n";
         fragment_shader += "{\n";
+    if (clip_mode == ClipMode::Discard) {
         fragment_shader += "if ((gl_FragCoord.x < v_clip_rect.x || gl_FragCoord.y < v_clip_rect.y) ||\n";
         fragment_shader += "    (gl_FragCoord.x > (v_clip_rect.x + v_clip_rect.z) || gl_FragCoord.y > (v_clip_rect.y + v_clip_rect.w))) {\n";
         fragment_shader += "discard;\n";
         fragment_shader += "}\n";
+    }
         fragment_shader += "vec4 sampled;\n";
+    if (backend == Backend::Array) {
+        fragment_shader += "switch (int(v_sampler_type)) {\n";
+        fragment_shader += "case 0: ";
+        fragment_shader += "sampled = vec4(1.0, 1.0, 1.0, 1.0);\n";
+        fragment_shader += "break;\n";
+        fragment_shader += "case 1: ";
+        fragment_shader += "sampled = texture(u_texture, v_texture_uv);\n";
+        fragment_shader += "break;\n";
+        fragment_shader += "case 2: ";
+        fragment_shader += "sampled = vec4(1.0, 1.0, 1.0, texture(u_text, v_texture_uv).r);\n";
+        fragment_shader += "break;\n";
+        fragment_shader += "case 3: ";
+        fragment_shader += "sampled = texture(u_layers, vec3(v_texture_uv, float(v_texture_slot_index)));\n";
+        fragment_shader += "break;\n";
+        fragment_shader += "case 4: ";
+        fragment_shader += "sampled = vec4(1.0, 1.0, 1.0, coverage(texture(u_text, v_texture_uv).r));\n";
+        fragment_shader += "break;\n";
+        fragment_shader += "}\n";
+    } else {
         fragment_shader += "switch (int(v_texture_slot_index)) {\n";
         for (int i = 0; i < max_texture_slots; i++) {
             fragment_shader += "case " + std::to_string(i) + ":\n";
@@ -67,388 +213,886 @@ Renderer::Renderer(unsigned int *indices) {
             fragment_shader += "case 2: ";
             fragment_shader += "sampled = vec4(1.0, 1.0, 1.0, texture(textures[" + std::to_string(i) + "], v_texture_uv).r);\n";
             fragment_shader += "break;\n";
+            fragment_shader += "case 4: ";
+            fragment_shader += "sampled = vec4(1.0, 1.0, 1.0, coverage(texture(textures[" + std::to_string(i) + "], v_texture_uv).r));\n";
+            fragment_shader += "break;\n";
             fragment_shader += "}\n";
             fragment_shader += "break;\n";
         }
         fragment_shader += "}\n";
+    }
         fragment_shader += "f_color = v_color * sampled;\n";
         fragment_shader += "}";
 
-    shader = Shader(
-        "#version 330 core\n"
-        "layout (location = 0) in vec2 a_opengl_position;\n"
-        "layout (location = 1) in vec2 a_texture_uv;\n"
-        "layout (location = 2) in vec4 a_color;\n"
-        "layout (location = 3) in float a_texture_slot_index;\n"
-        "layout (location = 4) in float a_sampler_type;\n"
-        "layout (location = 5) in vec4 a_rect;\n"
-        "layout (location = 6) in vec4 a_clip_rect;\n"
-        "\n"
-        "out vec2 v_texture_uv;\n"
-        "out vec4 v_color;\n"
-        "out float v_texture_slot_index;\n"
-        "out float v_sampler_type;\n"
-        "out vec4 v_clip_rect;\n"
-        "\n"
-        "uniform mat4 u_projection;\n"
-        "\n"
-        "void main()\n"
-        "{\n"
-            "mat4 model = mat4(\n"
-                "vec4(a_rect.z, 0.0, 0.0, 0.0),\n"
-                "vec4(0.0, a_rect.w, 0.0, 0.0),\n"
-                "vec4(0.0, 0.0, 1.0, 0.0),\n"
-                "vec4(a_rect.x, a_rect.y, 0.0, 1.0)\n"
-            ");\n"
-            "gl_Position = u_projection * model * vec4(a_opengl_position, 1.0, 1.0);\n"
-            "v_texture_uv = a_texture_uv;\n"
-            "v_color = a_color;\n"
-            "v_texture_slot_index = a_texture_slot_index;\n"
-            "v_sampler_type = a_sampler_type;\n"
-            "v_clip_rect = a_clip_rect;\n"
-        "}",
-        fragment_shader.c_str()
-    );
 
-    shader.use();
-    std::vector<int> texture_indices;
-    for (int i = 0; i < 32; i++) {
-        texture_indices.push_back(i);
+    return fragment_shader;
+}
+
+// Programs get compiled the first time a mode needs them.
+Shader* Renderer::program() {
+    int i = (mode == Mode::Instanced ? 2 : 0) + (clip_mode == ClipMode::Scissor ? 1 : 0);
+    if (!m_programs[i]) {
+        m_programs[i] = new Shader(
+            mode == Mode::Instanced ? instanced_vertex_shader : vertex_shader,
+            fragmentShader(clip_mode).c_str()
+        );
+        m_programs[i]->use();
+        if (backend == Backend::Array) {
+            glUniform1i(glGetUniformLocation(m_programs[i]->ID, "u_texture"), ARRAY_TEXTURE_UNIT);
+            glUniform1i(glGetUniformLocation(m_programs[i]->ID, "u_text"), ARRAY_TEXT_UNIT);
+            glUniform1i(glGetUniformLocation(m_programs[i]->ID, "u_layers"), ARRAY_LAYERS_UNIT);
+        } else {
+            std::vector<int> texture_indices;
+            for (int slot = 0; slot < 32; slot++) {
+                texture_indices.push_back(slot);
+            }
+            glUniform1iv(glGetUniformLocation(m_programs[i]->ID, "textures"), 32, texture_indices.data());
+        }
+        glUniformBlockBinding(m_programs[i]->ID, glGetUniformBlockIndex(m_programs[i]->ID, "ClipRects"), 0);
     }
-    auto loc = glGetUniformLocation(shader.ID, "textures");
-    glUniform1iv(loc, 32, texture_indices.data());
+    return m_programs[i];
 }
 
 Renderer::~Renderer() {
     glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
-    delete[] vertices;
+    glDeleteVertexArrays(1, &instanced_VAO);
+    glDeleteBuffers(1, &unit_quad_VBO);
+    glDeleteBuffers(1, &clip_UBO);
+    for (Shader *program : m_programs) {
+        if (program) {
+            glDeleteProgram(program->ID);
+            delete program;
+        }
+    }
+    delete vertex_stream;
+    delete instance_stream;
+    delete workers;
+    for (QuadList *quads : quad_lists) {
+        delete quads;
+    }
+}
+
+// Instanced draws have no base instance in GL 3.3 so the attributes
+// get pointed at the segment of the stream buffer that is being drawn.
+void Renderer::bindInstanceAttributes(size_t offset) {
+    glBindBuffer(GL_ARRAY_BUFFER, instance_stream->ID);
+    glVertexAttribPointer(1, 4, GL_SHORT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, rect)));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Instance), (void*)(offset + offsetof(Instance, texture_uv)));
+    glVertexAttribIPointer(3, 1, GL_UNSIGNED_SHORT, sizeof(Instance), (void*)(offset + offsetof(Instance, clip_index)));
+    glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (void*)(offset + offsetof(Instance, color)));
+    glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (void*)(offset + offsetof(Instance, to_color)));
+    glVertexAttribIPointer(6, 1, GL_UNSIGNED_BYTE, sizeof(Instance), (void*)(offset + offsetof(Instance, texture_index)));
+    glVertexAttribIPointer(7, 1, GL_UNSIGNED_BYTE, sizeof(Instance), (void*)(offset + offsetof(Instance, sampler)));
+    glVertexAttribIPointer(8, 1, GL_UNSIGNED_BYTE, sizeof(Instance), (void*)(offset + offsetof(Instance, flags)));
+}
+
+static int16_t clampToShort(int value) {
+    if (value < INT16_MIN) { return INT16_MIN; }
+    if (value > INT16_MAX) { return INT16_MAX; }
+    return (int16_t)value;
+}
+
+static uint16_t normalizeToShort(float value) {
+    if (value <= 0.0f) { return 0; }
+    if (value >= 1.0f) { return UINT16_MAX; }
+    return (uint16_t)(value * UINT16_MAX + 0.5f);
+}
+
+static Color mixColor(Color from, Color to, float t) {
+    return Color(
+        from.r + (to.r - from.r) * t,
+        from.g + (to.g - from.g) * t,
+        from.b + (to.b - from.b) * t,
+        from.a + (to.a - from.a) * t
+    );
+}
+
+static uint8_t normalizeToByte(float value) {
+    if (value <= 0.0f) { return 0; }
+    if (value >= 1.0f) { return UINT8_MAX; }
+    return (uint8_t)(value * UINT8_MAX + 0.5f);
+}
+
+Renderer::Sampler Renderer::textSampler(const Font *font) {
+    return font->rendering == Font::Rendering::DistanceField ? Sampler::DistanceField : Sampler::Text;
+}
+
+Renderer::Vertex Renderer::packVertex(int x, int y, float u, float v, Color color, int texture_index, Sampler sampler, uint16_t clip) {
+    return Vertex{
+        {clampToShort(x), clampToShort(y)},
+        {normalizeToShort(u), normalizeToShort(v)},
+        {normalizeToByte(color.r), normalizeToByte(color.g), normalizeToByte(color.b), normalizeToByte(color.a)},
+        (uint8_t)texture_index,
+        (uint8_t)sampler,
+        clip
+    };
+}
+
+Renderer::Instance Renderer::packInstance(int x0, int y0, int x1, int y1, float u0, float v0, float u1, float v1, Color color, Color to_color, int texture_index, Sampler sampler, uint16_t clip, uint8_t flags) {
+    return Instance{
+        {clampToShort(x0), clampToShort(y0), clampToShort(x1), clampToShort(y1)},
+        {normalizeToShort(u0), normalizeToShort(v0), normalizeToShort(u1), normalizeToShort(v1)},
+        {normalizeToByte(color.r), normalizeToByte(color.g), normalizeToByte(color.b), normalizeToByte(color.a)},
+        {normalizeToByte(to_color.r), normalizeToByte(to_color.g), normalizeToByte(to_color.b), normalizeToByte(to_color.a)},
+        clip,
+        (uint8_t)texture_index,
+        (uint8_t)sampler,
+        flags,
+        {0, 0, 0}
+    };
 }
 
 void Renderer::reset() {
+    m_resets++;
+    beginSpan();
+    m_span_count = 0;
+    current_texture_slot = 2;
+    m_image_texture = 0;
+    m_text_texture = 0;
+    clip_count = 0;
+    memset(m_clip_lookup, 0, sizeof(m_clip_lookup));
+    // Registered first so that it always ends up at NO_CLIP_INDEX.
+    clipIndex(Rect(INT16_MIN, INT16_MIN, UINT16_MAX, UINT16_MAX));
+    clip_index = clipIndex(clip_rect);
+}
+
+static uint32_t hashRect(Rect rect) {
+    uint32_t hash = 2166136261u;
+    int values[4] = { rect.x, rect.y, rect.w, rect.h };
+    for (int value : values) {
+        hash = (hash ^ (uint32_t)value) * 16777619u;
+    }
+    return hash;
+}
+
+uint16_t Renderer::clipIndex(Rect rect) {
+    uint32_t slot = hashRect(rect) & (CLIP_LOOKUP_SIZE - 1);
+    while (m_clip_lookup[slot]) {
+        uint16_t i = m_clip_lookup[slot] - 1;
+        if (clip_rects[i] == rect) { return i; }
+        slot = (slot + 1) & (CLIP_LOOKUP_SIZE - 1);
+    }
+    if (clip_count == MAX_CLIP_RECTS) {
+        // The table is full, flushing starts a new one with `clip_rect` in it.
+        render();
+        return clip_index;
+    }
+    clip_rects[clip_count] = rect;
+    m_clip_lookup[slot] = ++clip_count;
+    return clip_count - 1;
+}
+
+void Renderer::setClip(Rect rect) {
+    if (damage) { rect = rect.clipTo(damage.value); }
+    useClip(rect);
+}
+
+void Renderer::useClip(Rect rect) {
+    // The scissor rect is per draw so a different clip has to start a new batch,
+    // setting the same clip again keeps the current one going.
+    if (clip_mode == ClipMode::Scissor && !(rect == clip_rect) && (quad_count || m_span_count)) {
+        render();
+    }
+    clip_rect = rect;
+    clip_index = clipIndex(rect);
+}
+
+void Renderer::beginSpan() {
+    vertices = (Vertex*)vertex_stream->data();
+    instances = (Instance*)instance_stream->data();
+    index = 0;
+    quad_count = 0;
+}
+
+void Renderer::commitSpan() {
+    if (!quad_count) { return; }
+    size_t offset;
+    if (mode == Mode::Instanced) {
+        offset = instance_stream->commit(sizeof(Instance) * quad_count);
+    } else {
+        offset = vertex_stream->commit(sizeof(Vertex) * index);
+    }
+    m_spans[m_span_count++] = Span{offset, quad_count};
+    stats.quads += quad_count;
     index = 0;
     quad_count = 0;
-    current_texture_slot = 2;
 }
 
+// A full segment only ends the span, the batch keeps going in the next
+// segment and only gets drawn once the stream buffer says it is full.
 void Renderer::check() {
-    if (index + QUAD_VERTEX_COUNT > MAX_BATCH_SIZE * QUAD_VERTEX_COUNT) render();
+    if (quad_count + 1 > BATCH_SEGMENT_SIZE) {
+        commitSpan();
+        StreamBuffer *stream = mode == Mode::Instanced ? instance_stream : vertex_stream;
+        if (stream->full()) {
+            render();
+        } else {
+            beginSpan();
+        }
+    }
+}
+
+Renderer::Backend Renderer::chooseBackend() {
+    const char *requested = SDL_getenv("AGRO_RENDERER_BACKEND");
+    if (requested && std::string(requested) == "slots") { return Backend::Slots; }
+    int max_layers = 0;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+    // Layers are addressed through the 8 bit texture index of a vertex.
+    if (max_layers < 256 || max_texture_slots < 4) { return Backend::Slots; }
+    return Backend::Array;
 }
 
-void Renderer::textCheck(Font *font) {
-    if (index + QUAD_VERTEX_COUNT > MAX_BATCH_SIZE * QUAD_VERTEX_COUNT) {
+// Returns the texture index a vertex sampling `texture_ID` has to carry.
+// With Backend::Slots that is the slot the texture is bound to in the current
+// batch, binding it to the next free slot when it isn't bound yet.
+// Backend::Array has a single unit per sampler and has to flush when
+// a different texture gets bound to it.
+int Renderer::textureSlot(unsigned int texture_ID, Sampler sampler) {
+    if (backend == Backend::Array) {
+        bool is_text = sampler == Sampler::Text || sampler == Sampler::DistanceField;
+        unsigned int &bound = is_text ? m_text_texture : m_image_texture;
+        if (bound == texture_ID) {
+            stats.slot_hits++;
+            return 0;
+        }
+        stats.slot_misses++;
+        if (bound) { render(); }
+        bound = texture_ID;
+        glActiveTexture(gl_texture_begin + (is_text ? ARRAY_TEXT_UNIT : ARRAY_TEXTURE_UNIT));
+        glBindTexture(GL_TEXTURE_2D, texture_ID);
+        glActiveTexture(gl_texture_begin);
+        return 0;
+    }
+    for (int slot = 2; slot < current_texture_slot; slot++) {
+        if (m_slot_textures[slot] == texture_ID) {
+            stats.slot_hits++;
+            return slot;
+        }
+    }
+    stats.slot_misses++;
+    if (current_texture_slot > max_texture_slots - 1) {
         render();
-        glActiveTexture(gl_texture_begin + current_texture_slot);
-        glBindTexture(GL_TEXTURE_2D, font->atlas_ID);
     }
+    int slot = current_texture_slot++;
+    m_slot_textures[slot] = texture_ID;
+    glActiveTexture(gl_texture_begin + slot);
+    glBindTexture(GL_TEXTURE_2D, texture_ID);
+    // Textures created elsewhere get bound to whatever unit is active,
+    // leaving the first unit active keeps them away from the batch slots.
+    glActiveTexture(gl_texture_begin);
+    return slot;
 }
 
 void Renderer::fillText(Font *font, Slice<const char> text, Point point, Color color, int tab_width, bool is_multiline, int line_spacing, Selection selection, Color selection_color) {
-    Size window = Application::get()->size;
     if (selection.begin > selection.end) {
         auto temp = selection.end;
         selection.end = selection.begin;
         selection.begin = temp;
     }
 
-    if (current_texture_slot > max_texture_slots - 1) {
-        render();
+    const TextRun *run = &m_run;
+    if (text_runs) {
+        run = &text_runs->get(font, text, tab_width, is_multiline, line_spacing);
+    } else {
+        m_run.layout(font, text, tab_width, is_multiline, line_spacing);
     }
-    glActiveTexture(gl_texture_begin + current_texture_slot);
-    glBindTexture(GL_TEXTURE_2D, font->atlas_ID);
-    int x = point.x;
-    for (size_t i = 0; i < text.length; i++) {
-        char c = text.data[i];
-        textCheck(font);
-        Font::Character ch = font->characters[c];
-        int advance = ch.advance;
-        if (c == '\t') { advance = font->characters[' '].advance * tab_width; }
-        if (c == '\n' && is_multiline) {
-            point.y += font->max_height + line_spacing;
-            if (point.y >= window.h) { break; }
-            x = point.x;
+    // Glyphs can come from different pages, the slot changes along with the texture.
+    Sampler sampler = textSampler(font);
+    unsigned int texture = 0;
+    int slot = 0;
+    size_t i = 0;
+    while (i < run->count()) {
+        if (quad_count + 1 > BATCH_SEGMENT_SIZE) {
+            check();
+            texture = 0;
         }
-        if (!is_multiline && x > window.w) { break; }
-        auto _color = color;
-        if (selection.begin != selection.end && (i >= selection.begin && i < selection.end)) { _color = selection_color; }
-        if (x + advance >= 0 && x <= window.w) {
-            float xpos = x + ch.bearing.x;
-            float ypos = point.y + (font->characters['H'].bearing.y - ch.bearing.y);
+        if (run->texture[i] != texture) {
+            texture = run->texture[i];
+            slot = textureSlot(texture, sampler);
+        }
+#ifdef AGRO_SSE2
+        if (vectorized_text) {
+            i = fillGlyphs(*run, i, point, color, selection, selection_color, texture, slot, sampler);
+            if (i == run->count()) { break; }
+            // The SSE2 path may have filled the segment to the last quad
+            // or stopped at a glyph from another page.
+            if (quad_count + 1 > BATCH_SEGMENT_SIZE || run->texture[i] != texture) { continue; }
+        }
+#endif
+        int xpos = point.x + run->x[i];
+        int ypos = point.y + run->y[i];
+        int w = run->width[i];
+        int h = run->height[i];
+        ClipTest test = clipTest(Rect(xpos, ypos, w, h));
+        if (test == ClipTest::Outside) {
+            stats.culled++;
+        } else {
+            auto _color = color;
+            if (selection.begin != selection.end && (run->index[i] >= selection.begin && run->index[i] < selection.end)) { _color = selection_color; }
+            uint16_t clip = test == ClipTest::Inside ? NO_CLIP_INDEX : clip_index;
+            Vertex packed = packVertex(0, 0, 0.0, 0.0, _color, slot, sampler, clip);
+            if (mode == Mode::Instanced) {
+                Instance instance = packInstance(xpos, ypos, xpos + w, ypos + h, 0.0, 0.0, 0.0, 0.0, _color, _color, slot, sampler, clip);
+                memcpy(&instance.texture_uv[0], &run->uv_bottom_left[i], sizeof(uint32_t));
+                memcpy(&instance.texture_uv[2], &run->uv_top_right[i], sizeof(uint32_t));
+                instances[quad_count] = instance;
+            } else {
+                const int corners[QUAD_VERTEX_COUNT][2] = { {xpos, ypos + h}, {xpos, ypos}, {xpos + w, ypos}, {xpos + w, ypos + h} };
+                const uint32_t uvs[QUAD_VERTEX_COUNT] = { run->uv_top_left[i], run->uv_bottom_left[i], run->uv_bottom_right[i], run->uv_top_right[i] };
+                for (int corner = 0; corner < QUAD_VERTEX_COUNT; corner++) {
+                    packed.position[0] = clampToShort(corners[corner][0]);
+                    packed.position[1] = clampToShort(corners[corner][1]);
+                    memcpy(packed.texture_uv, &uvs[corner], sizeof(uint32_t));
+                    vertices[index++] = packed;
+                }
+            }
+            quad_count++;
+        }
+        i++;
+    }
+}
+
+#ifdef AGRO_SSE2
+static uint32_t packColor(Color color) {
+    return normalizeToByte(color.r) | normalizeToByte(color.g) << 8 | normalizeToByte(color.b) << 16 | (uint32_t)normalizeToByte(color.a) << 24;
+}
 
-            float w = ch.size.w;
-            float h = ch.size.h;
+// Emits the glyphs of `run` from `i` on four at a time and returns the index
+// of the first glyph it left for the scalar path, which happens at the end
+// of the run, when the batch segment fills up and when a glyph has to be
+// sampled from another texture than `texture`.
+// Each SSE2 register holds one 32 bit value for each of the four glyphs,
+// a vertex is 16 bytes so the vertices of a corner come out of a transpose.
+size_t Renderer::fillGlyphs(
+    const TextRun &run, size_t i, Point point, Color color, Selection selection, Color selection_color,
+    unsigned int texture, int slot, Sampler sampler
+) {
+    __m128i clip_x0 = _mm_set1_epi32(clip_rect.x);
+    __m128i clip_y0 = _mm_set1_epi32(clip_rect.y);
+    __m128i clip_x1 = _mm_set1_epi32(clip_rect.x + clip_rect.w);
+    __m128i clip_y1 = _mm_set1_epi32(clip_rect.y + clip_rect.h);
+    __m128i one = _mm_set1_epi32(1);
+    __m128i zero = _mm_setzero_si128();
+    __m128i textures = _mm_set1_epi32(texture);
+    __m128i pen_x = _mm_set1_epi32(point.x);
+    __m128i pen_y = _mm_set1_epi32(point.y);
+    __m128i colors = _mm_set1_epi32(packColor(color));
+    __m128i selection_colors = _mm_set1_epi32(packColor(selection_color));
+    bool has_selection = selection.begin != selection.end;
+    __m128i selection_begin = _mm_set1_epi32((int)std::min(selection.begin, (size_t)INT32_MAX));
+    __m128i selection_end = _mm_set1_epi32((int)std::min(selection.end, (size_t)INT32_MAX));
+    uint32_t sampler_type = (uint32_t)sampler;
+    // The last 32 bits of a Vertex, texture index, sampler and clip index.
+    __m128i vertex_tail = _mm_set1_epi32(slot | sampler_type << 8 | NO_CLIP_INDEX << 16);
+    __m128i vertex_clipped_tail = _mm_set1_epi32(slot | sampler_type << 8 | (uint32_t)clip_index << 16);
+    // The same three at their place in the second half of an Instance.
+    __m128i instance_tail = _mm_set1_epi32(NO_CLIP_INDEX | slot << 16 | sampler_type << 24);
+    __m128i instance_clipped_tail = _mm_set1_epi32(clip_index | slot << 16 | sampler_type << 24);
 
-            // TOP LEFT
-            vertices[index++] = {
-                {xpos, ypos + h},
-                {ch.texture_x, (h / font->atlas_height)},
-                {_color.r, _color.g, _color.b, _color.a},
-                (float)current_texture_slot,
-                (float)Renderer::Sampler::Text,
-                {1.0, 1.0, 1.0, 1.0},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
-            // BOTTOM LEFT
-            vertices[index++] = {
-                {xpos, ypos},
-                {ch.texture_x, 0.0},
-                {_color.r, _color.g, _color.b, _color.a},
-                (float)current_texture_slot,
-                (float)Renderer::Sampler::Text,
-                {1.0, 1.0, 1.0, 1.0},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
-            // BOTTOM RIGHT
-            vertices[index++] = {
-                {xpos + w, ypos},
-                {ch.texture_x + (w / font->atlas_width), 0.0},
-                {_color.r, _color.g, _color.b, _color.a},
-                (float)current_texture_slot,
-                (float)Renderer::Sampler::Text,
-                {1.0, 1.0, 1.0, 1.0},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
-            // TOP RIGHT
-            vertices[index++] = {
-                {xpos + w, ypos + h},
-                {ch.texture_x + (w / font->atlas_width), (h / font->atlas_height)},
-                {_color.r, _color.g, _color.b, _color.a},
-                (float)current_texture_slot,
-                (float)Renderer::Sampler::Text,
-                {1.0, 1.0, 1.0, 1.0},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
-            quad_count++;
+    for (; i + 4 <= run.count() && quad_count + 4 <= BATCH_SEGMENT_SIZE; i += 4) {
+        __m128i same_texture = _mm_cmpeq_epi32(textures, _mm_loadu_si128((const __m128i*)&run.texture[i]));
+        if (_mm_movemask_ps(_mm_castsi128_ps(same_texture)) != 0xF) {
+            break;
+        }
+        __m128i x0 = _mm_add_epi32(pen_x, _mm_loadu_si128((const __m128i*)&run.x[i]));
+        __m128i y0 = _mm_add_epi32(pen_y, _mm_loadu_si128((const __m128i*)&run.y[i]));
+        __m128i x1 = _mm_add_epi32(x0, _mm_loadu_si128((const __m128i*)&run.width[i]));
+        __m128i y1 = _mm_add_epi32(y0, _mm_loadu_si128((const __m128i*)&run.height[i]));
+
+        // The same tests as clipTest(), a <= b is written as b + 1 > a.
+        // Runs hold no empty glyphs so only the clip can cull them.
+        __m128i outside = _mm_or_si128(
+            _mm_or_si128(_mm_cmpgt_epi32(_mm_add_epi32(clip_x0, one), x1), _mm_cmpgt_epi32(x0, _mm_sub_epi32(clip_x1, one))),
+            _mm_or_si128(_mm_cmpgt_epi32(_mm_add_epi32(clip_y0, one), y1), _mm_cmpgt_epi32(y0, _mm_sub_epi32(clip_y1, one)))
+        );
+        __m128i not_inside = _mm_or_si128(
+            _mm_or_si128(_mm_cmpgt_epi32(clip_x0, x0), _mm_cmpgt_epi32(clip_y0, y0)),
+            _mm_or_si128(_mm_cmpgt_epi32(x1, clip_x1), _mm_cmpgt_epi32(y1, clip_y1))
+        );
+        int outside_mask = _mm_movemask_ps(_mm_castsi128_ps(outside));
+        if (outside_mask == 0xF) {
+            stats.culled += 4;
+            continue;
         }
-        x += advance;
-    }
-    current_texture_slot++;
-}
-
-Size Renderer::measureText(Font *font, std::string text, int tab_width, bool is_multiline, int line_spacing) {
-    Size size = Size(0, font->max_height);
-    int line_width = 0;
-    for (char c : text) {
-        Font::Character ch = font->characters[c];
-        if (c == '\t') {
-            line_width += font->characters[' '].advance * tab_width;
-        } else if (c == '\n' && is_multiline) {
-            size.h += font->max_height + line_spacing;
-            if (line_width > size.w) {
-                size.w = line_width;
-                line_width = 0;
+
+        __m128i color_words = colors;
+        if (has_selection) {
+            __m128i index = _mm_loadu_si128((const __m128i*)&run.index[i]);
+            __m128i selected = _mm_andnot_si128(_mm_cmpgt_epi32(selection_begin, index), _mm_cmpgt_epi32(selection_end, index));
+            color_words = _mm_or_si128(_mm_and_si128(selected, selection_colors), _mm_andnot_si128(selected, colors));
+        }
+
+        // Positions get saturated to 16 bits like clampToShort() and
+        // interleaved into x | y << 16 for each glyph.
+        __m128i top_left_y = _mm_packs_epi32(x0, y1);
+        __m128i bottom_left_y = _mm_packs_epi32(x0, y0);
+        __m128i bottom_right_y = _mm_packs_epi32(x1, y0);
+        __m128i top_right_y = _mm_packs_epi32(x1, y1);
+        __m128i positions[QUAD_VERTEX_COUNT] = {
+            _mm_unpacklo_epi16(top_left_y, _mm_srli_si128(top_left_y, 8)),
+            _mm_unpacklo_epi16(bottom_left_y, _mm_srli_si128(bottom_left_y, 8)),
+            _mm_unpacklo_epi16(bottom_right_y, _mm_srli_si128(bottom_right_y, 8)),
+            _mm_unpacklo_epi16(top_right_y, _mm_srli_si128(top_right_y, 8))
+        };
+        __m128i uvs[QUAD_VERTEX_COUNT] = {
+            _mm_loadu_si128((const __m128i*)&run.uv_top_left[i]),
+            _mm_loadu_si128((const __m128i*)&run.uv_bottom_left[i]),
+            _mm_loadu_si128((const __m128i*)&run.uv_bottom_right[i]),
+            _mm_loadu_si128((const __m128i*)&run.uv_top_right[i])
+        };
+
+        // Row `lane` of each transpose is the record of one glyph.
+        __m128i records[QUAD_VERTEX_COUNT][4];
+        if (mode == Mode::Instanced) {
+            __m128i tails = _mm_or_si128(_mm_and_si128(not_inside, instance_clipped_tail), _mm_andnot_si128(not_inside, instance_tail));
+            __m128i corners_low = _mm_unpacklo_epi32(positions[1], positions[3]);
+            __m128i corners_high = _mm_unpackhi_epi32(positions[1], positions[3]);
+            __m128i uv_low = _mm_unpacklo_epi32(uvs[1], uvs[3]);
+            __m128i uv_high = _mm_unpackhi_epi32(uvs[1], uvs[3]);
+            __m128i colors_low = _mm_unpacklo_epi32(color_words, color_words);
+            __m128i colors_high = _mm_unpackhi_epi32(color_words, color_words);
+            __m128i tails_low = _mm_unpacklo_epi32(tails, zero);
+            __m128i tails_high = _mm_unpackhi_epi32(tails, zero);
+            records[0][0] = _mm_unpacklo_epi64(corners_low, uv_low);
+            records[0][1] = _mm_unpackhi_epi64(corners_low, uv_low);
+            records[0][2] = _mm_unpacklo_epi64(corners_high, uv_high);
+            records[0][3] = _mm_unpackhi_epi64(corners_high, uv_high);
+            records[1][0] = _mm_unpacklo_epi64(colors_low, tails_low);
+            records[1][1] = _mm_unpackhi_epi64(colors_low, tails_low);
+            records[1][2] = _mm_unpacklo_epi64(colors_high, tails_high);
+            records[1][3] = _mm_unpackhi_epi64(colors_high, tails_high);
+            for (int lane = 0; lane < 4; lane++) {
+                if (outside_mask & (1 << lane)) {
+                    stats.culled++;
+                    continue;
+                }
+                _mm_storeu_si128((__m128i*)&instances[quad_count], records[0][lane]);
+                _mm_storeu_si128((__m128i*)&instances[quad_count] + 1, records[1][lane]);
+                quad_count++;
             }
         } else {
-            line_width += ch.advance;
+            __m128i tails = _mm_or_si128(_mm_and_si128(not_inside, vertex_clipped_tail), _mm_andnot_si128(not_inside, vertex_tail));
+            __m128i colors_low = _mm_unpacklo_epi32(color_words, tails);
+            __m128i colors_high = _mm_unpackhi_epi32(color_words, tails);
+            for (int corner = 0; corner < QUAD_VERTEX_COUNT; corner++) {
+                __m128i low = _mm_unpacklo_epi32(positions[corner], uvs[corner]);
+                __m128i high = _mm_unpackhi_epi32(positions[corner], uvs[corner]);
+                records[corner][0] = _mm_unpacklo_epi64(low, colors_low);
+                records[corner][1] = _mm_unpackhi_epi64(low, colors_low);
+                records[corner][2] = _mm_unpacklo_epi64(high, colors_high);
+                records[corner][3] = _mm_unpackhi_epi64(high, colors_high);
+            }
+            for (int lane = 0; lane < 4; lane++) {
+                if (outside_mask & (1 << lane)) {
+                    stats.culled++;
+                    continue;
+                }
+                for (int corner = 0; corner < QUAD_VERTEX_COUNT; corner++) {
+                    _mm_storeu_si128((__m128i*)&vertices[index++], records[corner][lane]);
+                }
+                quad_count++;
+            }
         }
     }
-    if (line_width > size.w) { size.w = line_width; }
+    return i;
+}
+#endif
 
-    return size;
+Size Renderer::measureText(Font *font, Slice<const char> text, int tab_width, bool is_multiline, int line_spacing) {
+    if (text_runs) {
+        return text_runs->get(font, text, tab_width, is_multiline, line_spacing).size;
+    }
+    m_run.layout(font, text, tab_width, is_multiline, line_spacing);
+    return m_run.size;
+}
+
+Size Renderer::measureText(Font *font, char c, int tab_width) {
+    if (c == '\t') {
+        return Size(font->metrics.advance[(unsigned char)' '] * tab_width, font->max_height);
+    }
+    return Size(font->metrics.advance[(unsigned char)c], font->max_height);
 }
 
 void Renderer::drawTexture(Point point, Size size, Texture *texture, TextureCoordinates *coords, Color color) {
+    ClipTest test = clipTest(Rect(point.x, point.y, size.w, size.h));
+    if (test == ClipTest::Outside) {
+        stats.culled++;
+        return;
+    }
     check();
 
-    if (current_texture_slot > max_texture_slots - 1) {
-        render();
+    int slot;
+    Sampler sampler = Sampler::Texture;
+    if (backend == Backend::Array && texture->layer >= 0) {
+        slot = texture->layer;
+        sampler = Sampler::Layer;
+    } else {
+        slot = textureSlot(texture->ID, Sampler::Texture);
+    }
+    // Either of the above can flush the batch which rebuilds the clip table.
+    uint16_t clip = test == ClipTest::Inside ? NO_CLIP_INDEX : clip_index;
+
+    if (mode == Mode::Instanced) {
+        // The bottom left and top right corners span the texture rectangle,
+        // when u changes along the y axis the image has been rotated by 90 degrees.
+        uint8_t flags = coords->top_left.x != coords->bottom_left.x ? Instance::SWAP_UV : 0;
+        instances[quad_count] = packInstance(
+            point.x, point.y, point.x + size.w, point.y + size.h,
+            texture->mapU(coords->bottom_left.x), texture->mapV(coords->bottom_left.y),
+            texture->mapU(coords->top_right.x), texture->mapV(coords->top_right.y),
+            color, color, slot, sampler, clip, flags
+        );
+    } else {
+        // TOP LEFT
+        vertices[index++] = packVertex(point.x, point.y + size.h, texture->mapU(coords->top_left.x), texture->mapV(coords->top_left.y), color, slot, sampler, clip);
+        // BOTTOM LEFT
+        vertices[index++] = packVertex(point.x, point.y, texture->mapU(coords->bottom_left.x), texture->mapV(coords->bottom_left.y), color, slot, sampler, clip);
+        // BOTTOM RIGHT
+        vertices[index++] = packVertex(point.x + size.w, point.y, texture->mapU(coords->bottom_right.x), texture->mapV(coords->bottom_right.y), color, slot, sampler, clip);
+        // TOP RIGHT
+        vertices[index++] = packVertex(point.x + size.w, point.y + size.h, texture->mapU(coords->top_right.x), texture->mapV(coords->top_right.y), color, slot, sampler, clip);
     }
-    glActiveTexture(gl_texture_begin + current_texture_slot);
-    glBindTexture(GL_TEXTURE_2D, texture->ID);
-
-    // TOP LEFT
-    vertices[index++] = {
-        {0.0, 1.0},
-        {(float)coords->top_left.x, (float)coords->top_left.y},
-        {color.r, color.g, color.b, color.a},
-        (float)current_texture_slot,
-        (float)Renderer::Sampler::Texture,
-        {(float)point.x, (float)point.y, (float)size.w, (float)size.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // BOTTOM LEFT
-    vertices[index++] = {
-        {0.0, 0.0},
-        {(float)coords->bottom_left.x, (float)coords->bottom_left.y},
-        {color.r, color.g, color.b, color.a},
-        (float)current_texture_slot,
-        (float)Renderer::Sampler::Texture,
-        {(float)point.x, (float)point.y, (float)size.w, (float)size.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // BOTTOM RIGHT
-    vertices[index++] = {
-        {1.0, 0.0},
-        {(float)coords->bottom_right.x, (float)coords->bottom_right.y},
-        {color.r, color.g, color.b, color.a},
-        (float)current_texture_slot,
-        (float)Renderer::Sampler::Texture,
-        {(float)point.x, (float)point.y, (float)size.w, (float)size.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // TOP RIGHT
-    vertices[index++] = {
-        {1.0, 1.0},
-        {(float)coords->top_right.x, (float)coords->top_right.y},
-        {color.r, color.g, color.b, color.a},
-        (float)current_texture_slot,
-        (float)Renderer::Sampler::Texture,
-        {(float)point.x, (float)point.y, (float)size.w, (float)size.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
     quad_count++;
-    current_texture_slot++;
 }
 
-void Renderer::render() {
-    shader.use();
+void Renderer::reserveIndices(unsigned int count) {
+    if (count <= m_index_capacity) { return; }
+    unsigned int capacity = m_index_capacity ? m_index_capacity : 64;
+    while (capacity < count) { capacity *= 2; }
+    if (capacity > BATCH_SEGMENT_SIZE) { capacity = BATCH_SEGMENT_SIZE; }
+    std::vector<unsigned int> indices(capacity * QUAD_INDEX_COUNT);
+    for (unsigned int quad = 0; quad < capacity; quad++) {
+        unsigned int i = quad * QUAD_INDEX_COUNT;
+        unsigned int offset = quad * QUAD_VERTEX_COUNT;
+        indices[i + 0] = 0 + offset;
+        indices[i + 1] = 1 + offset;
+        indices[i + 2] = 2 + offset;
+        indices[i + 3] = 2 + offset;
+        indices[i + 4] = 3 + offset;
+        indices[i + 5] = 0 + offset;
+    }
+    // The element buffer binding is part of the VAO.
     glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Vertex) * index, vertices);
-    glDrawElements(GL_TRIANGLES, QUAD_INDEX_COUNT * quad_count, GL_UNSIGNED_INT, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
+    m_index_capacity = capacity;
+}
+
+void Renderer::render() {
+    commitSpan();
+    if (!m_span_count) {
+        reset();
+        return;
+    }
+    stats.batches++;
+    if (backend == Backend::Array && atlas) {
+        glActiveTexture(gl_texture_begin + ARRAY_LAYERS_UNIT);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, atlas->array_ID);
+        glActiveTexture(gl_texture_begin);
+    }
+    Shader *program = this->program();
+    program->use();
+    program->setMatrix4("u_projection", m_projection);
+    if (clip_mode == ClipMode::Scissor) {
+        // Every quad of the batch shares `clip_rect`, see setClip().
+        Size window = target;
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(clip_rect.x, window.h - (clip_rect.y + clip_rect.h), clip_rect.w, clip_rect.h);
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, clip_UBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Rect) * clip_count, clip_rects);
+    }
+    if (mode == Mode::Instanced) {
+        // There is no base instance in GL 3.3 so every span is its own draw.
+        glBindVertexArray(instanced_VAO);
+        for (int i = 0; i < m_span_count; i++) {
+            bindInstanceAttributes(m_spans[i].offset);
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, QUAD_VERTEX_COUNT, m_spans[i].quad_count);
+            stats.draw_calls++;
+        }
+        instance_stream->fence();
+    } else {
+        GLsizei counts[STREAM_BUFFER_SEGMENTS];
+        const void *offsets[STREAM_BUFFER_SEGMENTS];
+        GLint base_vertices[STREAM_BUFFER_SEGMENTS];
+        unsigned int max_quads = 0;
+        for (int i = 0; i < m_span_count; i++) {
+            counts[i] = QUAD_INDEX_COUNT * m_spans[i].quad_count;
+            offsets[i] = nullptr;
+            base_vertices[i] = m_spans[i].offset / sizeof(Vertex);
+            if (m_spans[i].quad_count > max_quads) { max_quads = m_spans[i].quad_count; }
+        }
+        reserveIndices(max_quads);
+        glBindVertexArray(VAO);
+        glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts, GL_UNSIGNED_INT, offsets, m_span_count, base_vertices);
+        stats.draw_calls++;
+        vertex_stream->fence();
+    }
+    if (clip_mode == ClipMode::Scissor) {
+        glDisable(GL_SCISSOR_TEST);
+    }
     // TODO later on we could introduce rounded corners and circles by sampling pixels in the fragment shader??
     reset();
 }
 
-void Renderer::fillRect(Rect rect, Color color) {
-    check();
+void Renderer::setMode(Mode mode) {
+    if (this->mode != mode) {
+        render();
+        this->mode = mode;
+    }
+}
 
-    // TOP LEFT
-    vertices[index++] = {
-        {0.0, 1.0},
-        {0.0, 0.0},
-        {color.r, color.g, color.b, color.a},
-        0.0,
-        (float)Renderer::Sampler::Color,
-        {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // BOTTOM LEFT
-    vertices[index++] = {
-        {0.0, 0.0},
-        {0.0, 0.0},
-        {color.r, color.g, color.b, color.a},
-        0.0,
-        (float)Renderer::Sampler::Color,
-        {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // BOTTOM RIGHT
-    vertices[index++] = {
-        {1.0, 0.0},
-        {0.0, 0.0},
-        {color.r, color.g, color.b, color.a},
-        0.0,
-        (float)Renderer::Sampler::Color,
-        {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
-    // TOP RIGHT
-    vertices[index++] = {
-        {1.0, 1.0},
-        {0.0, 0.0},
-        {color.r, color.g, color.b, color.a},
-        0.0,
-        (float)Renderer::Sampler::Color,
-        {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-        {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-    };
+void Renderer::setClipMode(ClipMode clip_mode) {
+    if (this->clip_mode != clip_mode) {
+        render();
+        this->clip_mode = clip_mode;
+    }
+}
 
-    quad_count++;
+void Renderer::endFrame() {
+    GlyphAtlas::frame++;
+    frame_stats.batches = stats.batches - m_frame_start.batches;
+    frame_stats.draw_calls = stats.draw_calls - m_frame_start.draw_calls;
+    frame_stats.quads = stats.quads - m_frame_start.quads;
+    frame_stats.slot_hits = stats.slot_hits - m_frame_start.slot_hits;
+    frame_stats.slot_misses = stats.slot_misses - m_frame_start.slot_misses;
+    frame_stats.culled = stats.culled - m_frame_start.culled;
+    frame_stats.trimmed = stats.trimmed - m_frame_start.trimmed;
+    frame_stats.damaged_pixels = stats.damaged_pixels - m_frame_start.damaged_pixels;
+    m_frame_start = stats;
+}
+
+void Renderer::setWorkerCount(size_t count) {
+    delete workers;
+    workers = count ? new WorkerPool(count) : nullptr;
+}
+
+void Renderer::submit(const QuadList &quads) {
+    stats.culled += quads.culled;
+    stats.trimmed += quads.trimmed;
+    uint16_t clip = 0;
+    useClip(quads.clips[clip]);
+    // Consecutive quads mostly sample the same texture,
+    // its slot stays valid until the batch gets reset.
+    uint16_t source = QuadList::NO_SOURCE;
+    int slot = 0;
+    uint64_t resets = m_resets;
+    for (const QuadList::Quad &quad : quads.quads) {
+        if (quad.clip != clip) {
+            clip = quad.clip;
+            useClip(quads.clips[clip]);
+        }
+        check();
+        Instance instance = quad.instance;
+        if (quad.source != QuadList::NO_SOURCE) {
+            if (quad.source != source || resets != m_resets) {
+                const QuadList::Source &bound = quads.sources[quad.source];
+                slot = textureSlot(bound.ID, bound.sampler);
+                source = quad.source;
+                resets = m_resets;
+            }
+            instance.texture_index = slot;
+        }
+        instance.clip_index = quad.is_clipped ? clip_index : NO_CLIP_INDEX;
+        if (mode == Mode::Instanced) {
+            instances[quad_count] = instance;
+        } else {
+            pushVertices(instance);
+        }
+        quad_count++;
+    }
+    if (clip != quads.clips.size() - 1) {
+        useClip(quads.clips.back());
+    }
+}
+
+// Expands a quad in the Instance layout into the four vertices
+// the instanced vertex shader would have produced for it.
+void Renderer::pushVertices(const Instance &instance) {
+    // TOP LEFT, BOTTOM LEFT, BOTTOM RIGHT and TOP RIGHT.
+    const int corners[QUAD_VERTEX_COUNT][2] = { {0, 1}, {0, 0}, {1, 0}, {1, 1} };
+    bool swap_uv = instance.flags & Instance::SWAP_UV;
+    bool horizontal = instance.flags & Instance::HORIZONTAL_GRADIENT;
+    for (const int *corner : corners) {
+        int u = swap_uv ? corner[1] : corner[0];
+        int v = swap_uv ? corner[0] : corner[1];
+        const uint8_t *color = (horizontal ? corner[0] : corner[1]) ? instance.to_color : instance.color;
+        vertices[index++] = Vertex{
+            {instance.rect[corner[0] * 2], instance.rect[corner[1] * 2 + 1]},
+            {instance.texture_uv[u * 2], instance.texture_uv[v * 2 + 1]},
+            {color[0], color[1], color[2], color[3]},
+            instance.texture_index,
+            instance.sampler,
+            instance.clip_index
+        };
+    }
+}
+
+void Renderer::setProjection(const float *projection) {
+    memcpy(m_projection, projection, sizeof(m_projection));
+}
+
+const float* Renderer::projection() {
+    return m_projection;
+}
+
+void Renderer::fillRect(Rect rect, Color color) {
+    fillRectWithGradient(rect, color, color, Gradient::TopToBottom);
 }
 
 void Renderer::fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation) {
+    fillRectWithGradient(rect, fromColor, toColor, orientation, clipTest(rect));
+}
+
+void Renderer::fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation, ClipTest test) {
+    switch (test) {
+        case ClipTest::Outside:
+            stats.culled++;
+            return;
+        case ClipTest::Partial:
+            trimRect(rect, fromColor, toColor, orientation, clip_rect);
+            stats.trimmed++;
+            break;
+        case ClipTest::Inside:
+            break;
+    }
+    pushRect(rect, fromColor, toColor, orientation);
+}
+
+void Renderer::trimRect(Rect &rect, Color &fromColor, Color &toColor, Gradient orientation, Rect clip) {
+    int x0 = std::max(rect.x, clip.x);
+    int y0 = std::max(rect.y, clip.y);
+    int x1 = std::min(rect.x + rect.w, clip.x + clip.w);
+    int y1 = std::min(rect.y + rect.h, clip.y + clip.h);
+    Color from = fromColor;
+    if (orientation == Gradient::LeftToRight) {
+        fromColor = mixColor(from, toColor, (x0 - rect.x) / (float)rect.w);
+        toColor = mixColor(from, toColor, (x1 - rect.x) / (float)rect.w);
+    } else {
+        fromColor = mixColor(from, toColor, (y0 - rect.y) / (float)rect.h);
+        toColor = mixColor(from, toColor, (y1 - rect.y) / (float)rect.h);
+    }
+    rect = Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+// Expects `rect` to lie within the clip already.
+void Renderer::pushRect(Rect rect, Color fromColor, Color toColor, Gradient orientation) {
     check();
+    uint16_t clip = NO_CLIP_INDEX;
+
+    if (mode == Mode::Instanced) {
+        uint8_t flags = orientation == Gradient::LeftToRight ? Instance::HORIZONTAL_GRADIENT : 0;
+        instances[quad_count++] = packInstance(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, 0.0, 0.0, 0.0, 0.0, fromColor, toColor, 0, Sampler::Color, clip, flags);
+        return;
+    }
 
     switch (orientation) {
         case Gradient::TopToBottom: {
             // TOP LEFT
-            vertices[index++] = {
-                {0.0, 1.0},
-                {0.0, 0.0},
-                {toColor.r, toColor.g, toColor.b, toColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x, rect.y + rect.h, 0.0, 0.0, toColor, 0, Sampler::Color, clip);
             // BOTTOM LEFT
-            vertices[index++] = {
-                {0.0, 0.0},
-                {0.0, 0.0},
-                {fromColor.r, fromColor.g, fromColor.b, fromColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x, rect.y, 0.0, 0.0, fromColor, 0, Sampler::Color, clip);
             // BOTTOM RIGHT
-            vertices[index++] = {
-                {1.0, 0.0},
-                {0.0, 0.0},
-                {fromColor.r, fromColor.g, fromColor.b, fromColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x + rect.w, rect.y, 0.0, 0.0, fromColor, 0, Sampler::Color, clip);
             // TOP RIGHT
-            vertices[index++] = {
-                {1.0, 1.0},
-                {0.0, 0.0},
-                {toColor.r, toColor.g, toColor.b, toColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x + rect.w, rect.y + rect.h, 0.0, 0.0, toColor, 0, Sampler::Color, clip);
             break;
         }
         case Gradient::LeftToRight: {
             // TOP LEFT
-            vertices[index++] = {
-                {0.0, 1.0},
-                {0.0, 0.0},
-                {fromColor.r, fromColor.g, fromColor.b, fromColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x, rect.y + rect.h, 0.0, 0.0, fromColor, 0, Sampler::Color, clip);
             // BOTTOM LEFT
-            vertices[index++] = {
-                {0.0, 0.0},
-                {0.0, 0.0},
-                {fromColor.r, fromColor.g, fromColor.b, fromColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x, rect.y, 0.0, 0.0, fromColor, 0, Sampler::Color, clip);
             // BOTTOM RIGHT
-            vertices[index++] = {
-                {1.0, 0.0},
-                {0.0, 0.0},
-                {toColor.r, toColor.g, toColor.b, toColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x + rect.w, rect.y, 0.0, 0.0, toColor, 0, Sampler::Color, clip);
             // TOP RIGHT
-            vertices[index++] = {
-                {1.0, 1.0},
-                {0.0, 0.0},
-                {toColor.r, toColor.g, toColor.b, toColor.a},
-                0.0,
-                (float)Renderer::Sampler::Color,
-                {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h},
-                {(float)clip_rect.x, (float)clip_rect.y, (float)clip_rect.w, (float)clip_rect.h}
-            };
+            vertices[index++] = packVertex(rect.x + rect.w, rect.y + rect.h, 0.0, 0.0, toColor, 0, Sampler::Color, clip);
             break;
         }
     }
 
     quad_count++;
 }
+
+Renderer::ClipTest Renderer::clipTest(Rect rect) {
+    return clipTest(rect, clip_rect);
+}
+
+Renderer::ClipTest Renderer::clipTest(Rect rect, Rect clip) {
+    if (rect.w <= 0 || rect.h <= 0 ||
+        rect.x + rect.w <= clip.x || rect.x >= clip.x + clip.w ||
+        rect.y + rect.h <= clip.y || rect.y >= clip.y + clip.h) {
+        return ClipTest::Outside;
+    }
+    if (rect.x >= clip.x && rect.x + rect.w <= clip.x + clip.w &&
+        rect.y >= clip.y && rect.y + rect.h <= clip.y + clip.h) {
+        return ClipTest::Inside;
+    }
+    return ClipTest::Partial;
+}
+
+void Renderer::fillRects(const Rect *rects, size_t count, Color color) {
+    ClipTest tests[RENDERER_CLIP_TEST_BATCH];
+    for (size_t i = 0; i < count; i += RENDERER_CLIP_TEST_BATCH) {
+        size_t batch = std::min(count - i, (size_t)RENDERER_CLIP_TEST_BATCH);
+        clipTests(rects + i, batch, clip_rect, tests);
+        for (size_t j = 0; j < batch; j++) {
+            fillRectWithGradient(rects[i + j], color, color, Gradient::TopToBottom, tests[j]);
+        }
+    }
+}
+
+void Renderer::clipTests(const Rect *rects, size_t count, Rect clip, ClipTest *tests) {
+    size_t i = 0;
+#ifdef AGRO_SSE2
+    // Tests four rects at a time, the bits of `outside` and `not_inside`
+    // correspond to the rects in order.
+    __m128i clip_x0 = _mm_set1_epi32(clip.x);
+    __m128i clip_y0 = _mm_set1_epi32(clip.y);
+    __m128i clip_x1 = _mm_set1_epi32(clip.x + clip.w);
+    __m128i clip_y1 = _mm_set1_epi32(clip.y + clip.h);
+    __m128i one = _mm_set1_epi32(1);
+    for (; i + 4 <= count; i += 4) {
+        __m128i r0 = _mm_loadu_si128((const __m128i*)&rects[i + 0]);
+        __m128i r1 = _mm_loadu_si128((const __m128i*)&rects[i + 1]);
+        __m128i r2 = _mm_loadu_si128((const __m128i*)&rects[i + 2]);
+        __m128i r3 = _mm_loadu_si128((const __m128i*)&rects[i + 3]);
+        __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+        __m128i x0 = _mm_unpacklo_epi64(t0, t1);
+        __m128i y0 = _mm_unpackhi_epi64(t0, t1);
+        __m128i x1 = _mm_add_epi32(x0, _mm_unpacklo_epi64(t2, t3));
+        __m128i y1 = _mm_add_epi32(y0, _mm_unpackhi_epi64(t2, t3));
+
+        __m128i outside = _mm_or_si128(
+            _mm_or_si128(_mm_cmpgt_epi32(_mm_add_epi32(x0, one), x1), _mm_cmpgt_epi32(_mm_add_epi32(y0, one), y1)),
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpgt_epi32(_mm_add_epi32(clip_x0, one), x1), _mm_cmpgt_epi32(x0, _mm_sub_epi32(clip_x1, one))),
+                _mm_or_si128(_mm_cmpgt_epi32(_mm_add_epi32(clip_y0, one), y1), _mm_cmpgt_epi32(y0, _mm_sub_epi32(clip_y1, one)))
+            )
+        );
+        __m128i not_inside = _mm_or_si128(
+            _mm_or_si128(_mm_cmpgt_epi32(clip_x0, x0), _mm_cmpgt_epi32(clip_y0, y0)),
+            _mm_or_si128(_mm_cmpgt_epi32(x1, clip_x1), _mm_cmpgt_epi32(y1, clip_y1))
+        );
+        int outside_mask = _mm_movemask_ps(_mm_castsi128_ps(outside));
+        int not_inside_mask = _mm_movemask_ps(_mm_castsi128_ps(not_inside));
+
+        for (int j = 0; j < 4; j++) {
+            if (outside_mask & (1 << j)) {
+                tests[i + j] = ClipTest::Outside;
+            } else if (not_inside_mask & (1 << j)) {
+                tests[i + j] = ClipTest::Partial;
+            } else {
+                tests[i + j] = ClipTest::Inside;
+            }
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        tests[i] = clipTest(rects[i], clip);
+    }
+}
@@ -4,11 +4,13 @@
     #include <map>
     #include <string>
     #include <vector>
+    #include <cstdint>
 
     #include <ft2build.h>
     #include FT_FREETYPE_H
 
     #include "../slice.hpp"
+    #include "../option.hpp"
 
     #include "../common/enums.hpp"
     #include "../common/color.hpp"
@@ -20,23 +22,119 @@
     #include "shader.hpp"
     #include "batch.hpp"
     #include "texture.hpp"
+    #include "atlas.hpp"
+    #include "stream_buffer.hpp"
     #include "font.hpp"
+    #include "worker_pool.hpp"
+    #include "text_run_cache.hpp"
+
+    // Rects tested against the clip at once by fillRects() and DrawList::replay().
+    #define RENDERER_CLIP_TEST_BATCH 64
+
+    struct QuadList;
 
     struct Renderer {
         enum class Sampler {
             Color,
             Texture,
-            Text
+            Text,
+            /// A layer of the TextureAtlas array, only used by Backend::Array.
+            Layer,
+            /// Glyphs of a Font::Rendering::DistanceField font, the same
+            /// pages as Text but holding distances instead of coverage.
+            DistanceField
+        };
+
+        /// Decides how textures are made available to the fragment shader.
+        /// `Slots` binds every texture of a batch to its own texture unit and
+        /// generates a shader with a case for each of them.
+        /// `Array` keeps the atlas pages in layers of a single array texture
+        /// next to one unit each for a standalone image and a font, which
+        /// allows for a small fixed shader.
+        enum class Backend {
+            Slots,
+            Array
+        };
+
+        /// Decides how quads get clipped.
+        /// `Discard` tests every fragment against the clip rect of its quad,
+        /// which lets quads with different clips share a batch.
+        /// `Scissor` applies the clip with glScissor instead, which is cheaper
+        /// per fragment but requires a new batch whenever the clip changes.
+        enum class ClipMode {
+            Discard,
+            Scissor
         };
 
+        /// Decides how quads are submitted to the GPU.
+        /// `Vertices` emits four vertices per quad and draws them with the index buffer.
+        /// `Instanced` emits one Instance per quad which gets expanded
+        /// over a shared unit quad by the vertex shader.
+        enum class Mode {
+            Vertices,
+            Instanced
+        };
+
+        /// Packed vertex layout, 16 bytes per vertex.
+        /// Positions are in window pixels, texture coordinates and colors
+        /// are normalized integers that get expanded back to floats by the
+        /// vertex fetch and `clip_index` points into the clip rect table.
         struct Vertex {
-            float position[2];
-            float texture_uv[2];
-            float color[4];
-            float texture_index;
-            float is_text;
-            float rect[4];
-            float clip_rect[4];
+            int16_t position[2];
+            uint16_t texture_uv[2];
+            uint8_t color[4];
+            uint8_t texture_index;
+            uint8_t sampler;
+            uint16_t clip_index;
+        };
+
+        /// Packed per-quad record used by Mode::Instanced, 32 bytes per quad.
+        /// `rect` holds the opposite corners of the quad and `texture_uv`
+        /// the texture coordinates at those corners.
+        struct Instance {
+            enum Flags {
+                HORIZONTAL_GRADIENT = 1 << 0,
+                SWAP_UV = 1 << 1,
+            };
+
+            int16_t rect[4];
+            uint16_t texture_uv[4];
+            uint8_t color[4];
+            uint8_t to_color[4];
+            uint16_t clip_index;
+            uint8_t texture_index;
+            uint8_t sampler;
+            uint8_t flags;
+            uint8_t _padding[3];
+        };
+
+        /// A run of quads sharing one segment of the stream buffer,
+        /// every span of a batch gets submitted by the same render().
+        struct Span {
+            size_t offset;
+            unsigned int quad_count;
+        };
+
+        struct Stats {
+            uint64_t batches = 0;
+            uint64_t draw_calls = 0;
+            uint64_t quads = 0;
+            /// Textures that were already bound to a slot in the current batch.
+            uint64_t slot_hits = 0;
+            /// Textures that had to be bound to a new slot.
+            uint64_t slot_misses = 0;
+            /// Primitives dropped for lying entirely outside the clip.
+            uint64_t culled = 0;
+            /// Primitives cut down to the clip on the CPU.
+            uint64_t trimmed = 0;
+            /// Pixels inside the damaged area of each frame.
+            uint64_t damaged_pixels = 0;
+        };
+
+        enum class ClipTest {
+            Outside,
+            Inside,
+            Partial
         };
 
         struct Selection {
@@ -49,25 +147,136 @@
         int max_texture_slots;
         int current_texture_slot = 2;
         unsigned int gl_texture_begin = GL_TEXTURE0;
-        Shader shader;
+        Mode mode = Mode::Vertices;
+        Backend backend = Backend::Slots;
+        ClipMode clip_mode = ClipMode::Discard;
+        /// Lays text out four glyphs at a time where SSE2 is available,
+        /// turning it off is only useful for comparing against the scalar path.
+        bool vectorized_text = true;
+        /// Set by the DrawingContext, provides the array texture for Backend::Array.
+        TextureAtlas *atlas = nullptr;
+        /// Set by the DrawingContext, when set text gets laid out
+        /// through the cache instead of on every call.
+        TextRunCache *text_runs = nullptr;
+        /// Both counts refer to the span currently being written.
         unsigned int index = 0;
         unsigned int quad_count = 0;
-        Vertex *vertices = new Vertex[MAX_BATCH_SIZE * QUAD_VERTEX_COUNT];
-        unsigned int VAO, VBO, EBO;
+        Stats stats;
+        /// The difference in `stats` over the last frame, see endFrame().
+        Stats frame_stats;
+        /// Both point straight into the memory of their StreamBuffer.
+        Vertex *vertices = nullptr;
+        Instance *instances = nullptr;
+        StreamBuffer *vertex_stream = nullptr;
+        StreamBuffer *instance_stream = nullptr;
+        unsigned int VAO, EBO;
+        unsigned int instanced_VAO, unit_quad_VBO;
+        unsigned int clip_UBO;
         Rect clip_rect; // Gets set before each draw() in Application.
+        /// When set every clip gets intersected with it so that
+        /// nothing outside of the damaged area is drawn to.
+        Option<Rect> damage;
+        /// Size of the framebuffer being drawn to, set by the Window before
+        /// each frame and by a Layer while it draws into its own buffers.
+        Size target;
+        /// When set, long DrawLists have their quads generated on these
+        /// threads during DrawList::replay(), see setWorkerCount().
+        WorkerPool *workers = nullptr;
+        /// Reused by DrawList::replay() for the quads of each worker.
+        std::vector<QuadList*> quad_lists;
+
+        /// Deduplicated clip rectangles referenced by the current batch.
+        /// They get uploaded to the `ClipRects` uniform block in render()
+        /// so that changing the clip never has to break the batch.
+        Rect clip_rects[MAX_CLIP_RECTS];
+        uint16_t clip_count = 0;
+        uint16_t clip_index = 0;
 
-        Renderer(unsigned int *indices);
+        Renderer();
         ~Renderer();
         void fillText(Font *font, Slice<const char> text, Point point, Color color = COLOR_BLACK, int tab_width = 4, bool is_multiline = false, int line_spacing = 5, Selection selection = Selection(), Color selection_color = COLOR_BLACK);
-        Size measureText(Font *font, std::string text, int tab_width = 4, bool is_multiline = false, int line_spacing = 5);
+        Size measureText(Font *font, Slice<const char> text, int tab_width = 4, bool is_multiline = false, int line_spacing = 5);
+        /// Measures a single character straight from the font metrics.
+        Size measureText(Font *font, char c, int tab_width = 4);
         void drawTexture(Point point, Size size, Texture *texture, TextureCoordinates *coords, Color color = COLOR_WHITE);
         void fillRect(Rect rect, Color color);
         void fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation);
+        /// Same as above for a rect already tested against the current clip.
+        void fillRectWithGradient(Rect rect, Color fromColor, Color toColor, Gradient orientation, ClipTest test);
+        /// Same as calling fillRect() for each of the rects but tests them
+        /// against the clip together, see clipTests().
+        void fillRects(const Rect *rects, size_t count, Color color);
         void check();
-        void textCheck(Font *font);
         void render();
+        void setMode(Mode mode);
+        void setClipMode(ClipMode clip_mode);
+        void setClip(Rect rect);
+        void setProjection(const float *projection);
+        const float* projection();
+        void endFrame();
+        /// Starts `count` threads that generate quads for replayed DrawLists,
+        /// zero generates everything on the calling thread. The default
+        /// can be set with the `AGRO_RENDERER_WORKERS` environment variable.
+        void setWorkerCount(size_t count);
+        /// Appends quads generated by QuadList::build() to the current batch,
+        /// binding their textures and applying their clips in order.
+        void submit(const QuadList &quads);
+
+        static ClipTest clipTest(Rect rect, Rect clip);
+        /// Same as calling clipTest() for each of the rects, four at a time
+        /// where SSE2 is available.
+        static void clipTests(const Rect *rects, size_t count, Rect clip, ClipTest *tests);
+        /// Cuts a solid or gradient `rect` down to `clip`, which only needs
+        /// the colors at its new edges, afterwards it needs no clip test.
+        static void trimRect(Rect &rect, Color &fromColor, Color &toColor, Gradient orientation, Rect clip);
+        /// Sampler::DistanceField for distance field fonts, Sampler::Text otherwise.
+        static Sampler textSampler(const Font *font);
+        static Vertex packVertex(int x, int y, float u, float v, Color color, int texture_index, Sampler sampler, uint16_t clip);
+        static Instance packInstance(int x0, int y0, int x1, int y1, float u0, float v0, float u1, float v1, Color color, Color to_color, int texture_index, Sampler sampler, uint16_t clip, uint8_t flags = 0);
 
         private:
+            /// Open addressed lookup from a clip rectangle to its position
+            /// in `clip_rects`, offset by one so that zero marks an empty entry.
+            uint16_t m_clip_lookup[CLIP_LOOKUP_SIZE];
+            /// The texture bound to each slot in the current batch,
+            /// only the slots below `current_texture_slot` are valid.
+            unsigned int m_slot_textures[MAX_TEXTURE_SLOTS];
+            /// One program per Mode and ClipMode, compiled on first use.
+            Shader *m_programs[4] = {};
+            float m_projection[16] = {};
+            Stats m_frame_start;
+            /// The textures bound to the units of Backend::Array.
+            unsigned int m_image_texture = 0;
+            unsigned int m_text_texture = 0;
+            Span m_spans[STREAM_BUFFER_SEGMENTS];
+            int m_span_count = 0;
+            /// Number of quads the index buffer currently has indices for.
+            unsigned int m_index_capacity = 0;
+            /// Counts the calls to reset(), texture slots looked up
+            /// before the last one are no longer bound.
+            uint64_t m_resets = 0;
+            /// Holds the layout of uncached text.
+            TextRun m_run;
+
             void reset();
+            void useClip(Rect rect);
+            void beginSpan();
+            void commitSpan();
+            void reserveIndices(unsigned int count);
+            int textureSlot(unsigned int texture_ID, Sampler sampler);
+            Backend chooseBackend();
+            std::string fragmentShader(ClipMode clip_mode);
+            Shader* program();
+            ClipTest clipTest(Rect rect);
+            void pushRect(Rect rect, Color fromColor, Color toColor, Gradient orientation);
+            uint16_t clipIndex(Rect rect);
+            void bindInstanceAttributes(size_t offset);
+            void pushVertices(const Instance &instance);
+#ifdef AGRO_SSE2
+            size_t fillGlyphs(
+                const TextRun &run, size_t i, Point point, Color color, Selection selection, Color selection_color,
+                unsigned int texture, int slot, Sampler sampler
+            );
+#endif
     };
 #endif
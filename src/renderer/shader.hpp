@@ -6,7 +6,10 @@
     #include <sstream>
     #include <iostream>
 
+    #include <SDL.h>
+
     #include "glad.h"
+    #include "program_cache.hpp"
     #include "../util.hpp"
 
     class Shader {
@@ -22,6 +25,9 @@
             }
 
             void compile(const char *vertext_shader, const char *fragment_shader) {
+                ID = glCreateProgram();
+                if (ProgramCache::load(ID, vertext_shader, fragment_shader)) { return; }
+                uint64_t start = SDL_GetPerformanceCounter();
                 unsigned int vertex, fragment;
 
                 vertex = glCreateShader(GL_VERTEX_SHADER);
@@ -34,14 +40,19 @@
                 glCompileShader(fragment);
                 checkCompileErrors(fragment, "FRAGMENT");
 
-                ID = glCreateProgram();
                 glAttachShader(ID, vertex);
                 glAttachShader(ID, fragment);
+                ProgramCache::prepare(ID);
                 glLinkProgram(ID);
-                checkCompileErrors(ID, "PROGRAM");
+                if (checkCompileErrors(ID, "PROGRAM")) {
+                    ProgramCache::store(ID, vertext_shader, fragment_shader);
+                }
 
+                glDetachShader(ID, vertex);
+                glDetachShader(ID, fragment);
                 glDeleteShader(vertex);
                 glDeleteShader(fragment);
+                ProgramCache::stats.compile_ms += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
             }
 
             void use() {
@@ -80,7 +91,7 @@
                 glUniformMatrix4fv(glGetUniformLocation(this->ID, name), 1, false, matrix);
             }
 
-            void checkCompileErrors(unsigned int shader, std::string type) {
+            bool checkCompileErrors(unsigned int shader, std::string type) {
                 int success;
                 char infoLog[1024];
                 if (type != "PROGRAM")
@@ -101,6 +112,7 @@
                         std::cout << "ERROR::PROGRAM_LINKING_ERROR of type: " << type << "\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
                     }
                 }
+                return success;
             }
     };
 #endif
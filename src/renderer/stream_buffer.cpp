@@ -0,0 +1,112 @@
+#include <SDL.h>
+
+#include "stream_buffer.hpp"
+
+// glad is generated for GL 3.3 core so the `ARB_buffer_storage`
+// entry point and its flags are loaded here by hand.
+#ifndef GL_MAP_PERSISTENT_BIT
+    #define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+    #define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+static PFNGLBUFFERSTORAGEPROC bufferStorage = nullptr;
+
+bool StreamBuffer::persistentMappingSupported() {
+    if (!bufferStorage && SDL_GL_ExtensionSupported("GL_ARB_buffer_storage")) {
+        bufferStorage = (PFNGLBUFFERSTORAGEPROC)SDL_GL_GetProcAddress("glBufferStorage");
+    }
+    return bufferStorage != nullptr;
+}
+
+StreamBuffer::StreamBuffer(size_t segment_size) : segment_size{segment_size} {
+    glGenBuffers(1, &ID);
+    glBindBuffer(GL_ARRAY_BUFFER, ID);
+    if (persistentMappingSupported()) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        bufferStorage(GL_ARRAY_BUFFER, segment_size * STREAM_BUFFER_SEGMENTS, nullptr, flags);
+        m_mapped = (unsigned char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, segment_size * STREAM_BUFFER_SEGMENTS, flags);
+    }
+    if (m_mapped) {
+        is_persistent = true;
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, segment_size * STREAM_BUFFER_SEGMENTS, nullptr, GL_STREAM_DRAW);
+        m_staging = new unsigned char[segment_size];
+    }
+}
+
+StreamBuffer::~StreamBuffer() {
+    for (GLsync fence : m_fences) {
+        if (fence) { glDeleteSync(fence); }
+    }
+    if (m_mapped) {
+        glBindBuffer(GL_ARRAY_BUFFER, ID);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    glDeleteBuffers(1, &ID);
+    delete[] m_staging;
+}
+
+void* StreamBuffer::data() {
+    if (is_persistent) {
+        wait(m_segment);
+        return m_mapped + m_segment * segment_size;
+    }
+    return m_staging;
+}
+
+size_t StreamBuffer::commit(size_t size) {
+    stats.uploads++;
+    stats.bytes_uploaded += size;
+    size_t offset = m_segment * segment_size;
+    // The persistent mapping is coherent so the writes are already visible.
+    if (!is_persistent) {
+        glBindBuffer(GL_ARRAY_BUFFER, ID);
+        if (m_segment == 0) {
+            glBufferData(GL_ARRAY_BUFFER, segment_size * STREAM_BUFFER_SEGMENTS, nullptr, GL_STREAM_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, m_staging);
+    }
+    m_segment = (m_segment + 1) % STREAM_BUFFER_SEGMENTS;
+    m_pending++;
+    return offset;
+}
+
+bool StreamBuffer::full() {
+    // Filling the last free segment would leave the next batch waiting on
+    // the first segment of this one, which was submitted a moment ago.
+    if (is_persistent) { return m_pending == STREAM_BUFFER_SEGMENTS - 1; }
+    return m_pending == STREAM_BUFFER_SEGMENTS;
+}
+
+void StreamBuffer::fence() {
+    if (is_persistent) {
+        for (int i = 1; i <= m_pending; i++) {
+            int segment = (m_segment - i + STREAM_BUFFER_SEGMENTS) % STREAM_BUFFER_SEGMENTS;
+            m_fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+    } else {
+        // Orphaning in the middle of a batch would throw away the
+        // segments it has uploaded but not drawn yet.
+        m_segment = 0;
+    }
+    m_pending = 0;
+}
+
+void StreamBuffer::wait(int segment) {
+    GLsync fence = m_fences[segment];
+    if (!fence) { return; }
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+        stats.stalls_avoided++;
+    } else {
+        stats.fence_waits++;
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+    }
+    glDeleteSync(fence);
+    m_fences[segment] = nullptr;
+}
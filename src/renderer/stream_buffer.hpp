@@ -0,0 +1,69 @@
+#ifndef STREAM_BUFFER_HPP
+    #define STREAM_BUFFER_HPP
+
+    #include <cstddef>
+    #include <cstdint>
+
+    #include "glad.h"
+
+    #define STREAM_BUFFER_SEGMENTS 8
+
+    /// A vertex buffer for data that gets rewritten every batch.
+    /// The buffer is split into segments that are used round robin and
+    /// a batch may fill several of them before it gets drawn.
+    /// When `ARB_buffer_storage` is available the buffer is mapped once,
+    /// persistently, and each segment is guarded by a fence so the CPU only
+    /// waits when it catches up with a draw the GPU has not finished yet.
+    /// A batch never takes the whole ring, so the segment the next batch
+    /// starts in is never one the GPU has only just been handed.
+    /// Otherwise the data is staged in CPU memory and uploaded into its
+    /// segment. Every batch starts over at the first segment and orphans
+    /// the buffer there, which lets the driver hand out fresh storage
+    /// instead of synchronizing with the previous draws.
+    struct StreamBuffer {
+        struct Stats {
+            uint64_t uploads = 0;
+            uint64_t bytes_uploaded = 0;
+            /// Segment reuses that had to wait for the GPU.
+            uint64_t fence_waits = 0;
+            /// Segment reuses whose fence had already signaled.
+            uint64_t stalls_avoided = 0;
+        };
+
+        unsigned int ID = 0;
+        size_t segment_size = 0;
+        bool is_persistent = false;
+        Stats stats;
+
+        StreamBuffer(size_t segment_size);
+        ~StreamBuffer();
+
+        /// Returns the memory of the current segment, at most `segment_size` bytes.
+        void* data();
+
+        /// Makes the first `size` bytes written to data() visible to the GPU,
+        /// moves on to the next segment and returns the offset of those bytes
+        /// within the buffer.
+        size_t commit(size_t size);
+
+        /// Whether the batch has committed as many segments as it may,
+        /// in which case the pending draws need to be submitted before
+        /// data() can be written to again. That is one less than the
+        /// ring when it is persistently mapped.
+        bool full();
+
+        /// Must be called after the draw calls that read the committed segments.
+        void fence();
+
+        static bool persistentMappingSupported();
+
+        private:
+            unsigned char *m_mapped = nullptr;
+            unsigned char *m_staging = nullptr;
+            int m_segment = 0;
+            int m_pending = 0;
+            GLsync m_fences[STREAM_BUFFER_SEGMENTS] = {};
+
+            void wait(int segment);
+    };
+#endif
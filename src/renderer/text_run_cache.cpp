@@ -0,0 +1,171 @@
+#include <cstring>
+
+#include "text_run_cache.hpp"
+
+void TextRun::push(int pen_x, int pen_y, const Font::Glyph &glyph, uint32_t i) {
+    x.push_back(pen_x + glyph.offset_x + 1);
+    y.push_back(pen_y + glyph.offset_y + 1);
+    width.push_back(glyph.width);
+    height.push_back(glyph.height);
+    uv_top_left.push_back(glyph.uv_top_left);
+    uv_bottom_left.push_back(glyph.uv_bottom_left);
+    uv_bottom_right.push_back(glyph.uv_bottom_right);
+    uv_top_right.push_back(glyph.uv_top_right);
+    texture.push_back(glyph.texture);
+    index.push_back(i);
+}
+
+// Glyphs sit one pixel right and down from their pen position,
+// which is where the previous model matrix used to put them.
+// The size follows Renderer::measureText() to the letter.
+// ASCII comes straight out of the Metrics tables, anything else gets
+// decoded from UTF-8 and looked up, and maybe rasterized, by the Font.
+void TextRun::layout(Font *font, Slice<const char> text, int tab_width, bool is_multiline, int line_spacing) {
+    const Font::Metrics &metrics = font->metrics;
+    int tab_advance = metrics.advance[(unsigned char)' '] * tab_width;
+    x.clear();
+    y.clear();
+    width.clear();
+    height.clear();
+    uv_top_left.clear();
+    uv_bottom_left.clear();
+    uv_bottom_right.clear();
+    uv_top_right.clear();
+    texture.clear();
+    index.clear();
+    size = Size(0, font->max_height);
+    generation = font->atlas->generation;
+    int line_width = 0;
+    int pen_x = 0;
+    int pen_y = 0;
+    size_t i = 0;
+    while (i < text.length) {
+        size_t start = i;
+        unsigned char c = text.data[i];
+        if (c >= 128) {
+            const Font::Glyph &glyph = font->glyph(Font::decode(text, i));
+            line_width += glyph.advance;
+            if (glyph.width && glyph.height) {
+                push(pen_x, pen_y, glyph, start);
+            }
+            pen_x += glyph.advance;
+            continue;
+        }
+        int advance = c == '\t' ? tab_advance : metrics.advance[c];
+        if (c == '\n' && is_multiline) {
+            pen_y += font->max_height + line_spacing;
+            pen_x = 0;
+            size.h += font->max_height + line_spacing;
+            if (line_width > size.w) {
+                size.w = line_width;
+                line_width = 0;
+            }
+        } else {
+            line_width += advance;
+        }
+        if (metrics.width[c] && metrics.height[c]) {
+            x.push_back(pen_x + metrics.offset_x[c] + 1);
+            y.push_back(pen_y + metrics.offset_y[c] + 1);
+            width.push_back(metrics.width[c]);
+            height.push_back(metrics.height[c]);
+            uv_top_left.push_back(metrics.uv_top_left[c]);
+            uv_bottom_left.push_back(metrics.uv_bottom_left[c]);
+            uv_bottom_right.push_back(metrics.uv_bottom_right[c]);
+            uv_top_right.push_back(metrics.uv_top_right[c]);
+            texture.push_back(metrics.texture[c]);
+            index.push_back(i);
+        }
+        pen_x += advance;
+        i++;
+    }
+    if (line_width > size.w) { size.w = line_width; }
+}
+
+size_t TextRun::count() const {
+    return x.size();
+}
+
+size_t TextRun::bytes() const {
+    return count() * (sizeof(int32_t) * 4 + sizeof(uint32_t) * 6);
+}
+
+TextRunCache::TextRunCache(size_t budget) : budget{budget} {
+
+}
+
+static uint64_t hashText(Slice<const char> text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < text.length; i++) {
+        hash = (hash ^ (unsigned char)text.data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+const TextRun& TextRunCache::get(Font *font, Slice<const char> text, int tab_width, bool is_multiline, int line_spacing) {
+    if (!is_multiline) { line_spacing = 0; }
+    uint64_t hash = hashText(text);
+    hash = (hash ^ font->serial) * 1099511628211ull;
+    hash = (hash ^ (uint64_t)tab_width) * 1099511628211ull;
+    hash = (hash ^ (uint64_t)(line_spacing * 2 + is_multiline)) * 1099511628211ull;
+
+    auto range = m_lookup.equal_range(hash);
+    for (auto it = range.first; it != range.second; it++) {
+        Entry &entry = *it->second;
+        if (entry.font == font && entry.font_serial == font->serial && entry.tab_width == tab_width &&
+            entry.is_multiline == is_multiline && entry.line_spacing == line_spacing &&
+            entry.text.size() == text.length && !memcmp(entry.text.data(), text.data, text.length)) {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            // The font evicted glyphs since the run was laid out.
+            if (entry.run.generation != font->atlas->generation) {
+                stats.misses++;
+                m_bytes -= bytes(entry);
+                entry.run.layout(font, text, tab_width, is_multiline, line_spacing);
+                m_bytes += bytes(entry);
+                evict();
+                return entry.run;
+            }
+            stats.hits++;
+            return entry.run;
+        }
+    }
+
+    stats.misses++;
+    m_entries.push_front(Entry{font, font->serial, hash, tab_width, is_multiline, line_spacing, std::vector<char>(text.data, text.data + text.length), TextRun()});
+    Entry &entry = m_entries.front();
+    entry.run.layout(font, text, tab_width, is_multiline, line_spacing);
+    m_lookup.insert(std::make_pair(hash, m_entries.begin()));
+    m_bytes += bytes(entry);
+    evict();
+    return entry.run;
+}
+
+void TextRunCache::clear() {
+    m_entries.clear();
+    m_lookup.clear();
+    m_bytes = 0;
+}
+
+size_t TextRunCache::bytes() {
+    return m_bytes;
+}
+
+size_t TextRunCache::bytes(const Entry &entry) {
+    return sizeof(Entry) + entry.text.size() + entry.run.bytes();
+}
+
+// Never evicts the most recently used run, which is the one get() returns.
+void TextRunCache::evict() {
+    while (m_bytes > budget && m_entries.size() > 1) {
+        Entry &entry = m_entries.back();
+        auto range = m_lookup.equal_range(entry.hash);
+        for (auto it = range.first; it != range.second; it++) {
+            if (&*it->second == &entry) {
+                m_lookup.erase(it);
+                break;
+            }
+        }
+        m_bytes -= bytes(entry);
+        m_entries.pop_back();
+        stats.evictions++;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef TEXT_RUN_CACHE_HPP
+    #define TEXT_RUN_CACHE_HPP
+
+    #include <list>
+    #include <vector>
+    #include <cstdint>
+    #include <unordered_map>
+
+    #include "../slice.hpp"
+    #include "../common/size.hpp"
+
+    #include "font.hpp"
+
+    // Bytes of glyph data the cache holds on to before evicting runs.
+    #define TEXT_RUN_CACHE_BUDGET (4 * 1024 * 1024)
+
+    /// A piece of UTF-8 text laid out with a Font, the glyphs are positioned
+    /// relative to the pen at the start of the text so the same run can be
+    /// drawn anywhere. Glyphs without any pixels, like whitespace, are left
+    /// out and the glyph data is kept in structure of arrays form.
+    struct TextRun {
+        /// The same size Renderer::measureText() reports.
+        Size size;
+        std::vector<int32_t> x;
+        std::vector<int32_t> y;
+        std::vector<int32_t> width;
+        std::vector<int32_t> height;
+        /// Packed texture coordinates, see Font::Metrics.
+        std::vector<uint32_t> uv_top_left;
+        std::vector<uint32_t> uv_bottom_left;
+        std::vector<uint32_t> uv_bottom_right;
+        std::vector<uint32_t> uv_top_right;
+        /// The page texture each glyph has to be sampled from.
+        std::vector<unsigned int> texture;
+        /// Byte offset of the character within the text, used for the selection.
+        std::vector<uint32_t> index;
+        /// GlyphAtlas::generation at the time of the layout, the texture
+        /// coordinates are stale once the atlas moved on.
+        uint64_t generation = 0;
+
+        void layout(Font *font, Slice<const char> text, int tab_width, bool is_multiline, int line_spacing);
+        size_t count() const;
+        /// Bytes of glyph data held by the run.
+        size_t bytes() const;
+
+        private:
+            void push(int pen_x, int pen_y, const Font::Glyph &glyph, uint32_t i);
+    };
+
+    /// Keeps the TextRuns of recently drawn and measured text around so that
+    /// text that doesn't change from frame to frame gets laid out only once.
+    /// Runs are keyed by font, text, tab width and line layout, and the ones
+    /// used least recently get evicted once the runs take up more than
+    /// `budget` bytes. Runs are matched by the address and Font::serial of
+    /// their Font, so the runs of a deleted Font never get handed out for
+    /// another one, they just age out. Runs get laid out again once the
+    /// Font has evicted any of its glyphs.
+    struct TextRunCache {
+        struct Stats {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+        };
+
+        size_t budget;
+        Stats stats;
+
+        TextRunCache(size_t budget = TEXT_RUN_CACHE_BUDGET);
+
+        /// Returns the run for the text, laying it out on a miss.
+        /// The run stays valid until the next call.
+        const TextRun& get(Font *font, Slice<const char> text, int tab_width, bool is_multiline, int line_spacing);
+        void clear();
+        /// Bytes held by the cached runs.
+        size_t bytes();
+
+        private:
+            struct Entry {
+                Font *font;
+                /// Tells a Font apart from a later one at the same address.
+                uint64_t font_serial;
+                uint64_t hash;
+                int tab_width;
+                bool is_multiline;
+                int line_spacing;
+                std::vector<char> text;
+                TextRun run;
+            };
+
+            /// Most recently used first.
+            std::list<Entry> m_entries;
+            std::unordered_multimap<uint64_t, std::list<Entry>::iterator> m_lookup;
+            size_t m_bytes = 0;
+
+            static size_t bytes(const Entry &entry);
+            void evict();
+    };
+#endif
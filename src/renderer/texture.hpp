@@ -77,6 +77,15 @@
         int height = -1;
         int nr_channels = -1;
         unsigned int ID;
+        /// The part of the GL texture occupied by the image, textures packed
+        /// into a TextureAtlas page share their ID with the rest of the page.
+        float u0 = 0.0;
+        float v0 = 0.0;
+        float u1 = 1.0;
+        float v1 = 1.0;
+        bool owns_ID = true;
+        /// Layer within a layered TextureAtlas, -1 for everything else.
+        int layer = -1;
 
         Texture(std::string file_path) {
             unsigned char *data = stbi_load(
@@ -102,33 +111,57 @@
             makeGLTexture(data, width, height, nr_channels, ":memory:");
         }
 
+        /// Uploads `width` by `height` RGBA pixels, which stay with the caller.
+        Texture(const unsigned char *pixels, int width, int height)
+        : width{width}, height{height}, nr_channels{4} {
+            uploadGLTexture(pixels, width, height, nr_channels);
+        }
+
+        Texture(unsigned int ID, int width, int height, float u0, float v0, float u1, float v1, int layer = -1)
+        : width{width}, height{height}, nr_channels{4}, ID{ID}, u0{u0}, v0{v0}, u1{u1}, v1{v1}, owns_ID{false}, layer{layer} {
+
+        }
+
         ~Texture() {
-            glDeleteTextures(1, &this->ID);
+            if (owns_ID) { glDeleteTextures(1, &this->ID); }
+        }
+
+        /// Maps a coordinate relative to the image into the GL texture.
+        float mapU(float u) {
+            return u0 + u * (u1 - u0);
+        }
+
+        float mapV(float v) {
+            return v0 + v * (v1 - v0);
         }
 
         void makeGLTexture(unsigned char *data, int width, int height, int nr_channels, std::string file_path) {
             if (data) {
-                glActiveTexture(GL_TEXTURE0);
-                glGenTextures(1, &ID);
-                glBindTexture(GL_TEXTURE_2D, ID);
-
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                // TODO get some grayscale, and grayscale + alpha images to test 1 and 2 channel textures
-                assert((nr_channels == 3 || nr_channels == 4) && "Unsupported number of channels!");
-                if (nr_channels == 4) {
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-                } else {
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-                }
-                glGenerateMipmap(GL_TEXTURE_2D);
+                uploadGLTexture(data, width, height, nr_channels);
                 stbi_image_free(data);
             } else {
                 error("FAILED_TO_LOAD_TEXTURE", file_path);
             }
         }
+
+        void uploadGLTexture(const unsigned char *data, int width, int height, int nr_channels) {
+            glActiveTexture(GL_TEXTURE0);
+            glGenTextures(1, &ID);
+            glBindTexture(GL_TEXTURE_2D, ID);
+
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            // TODO get some grayscale, and grayscale + alpha images to test 1 and 2 channel textures
+            assert((nr_channels == 3 || nr_channels == 4) && "Unsupported number of channels!");
+            if (nr_channels == 4) {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            } else {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+            }
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
     };
 #endif
@@ -0,0 +1,62 @@
+#include "worker_pool.hpp"
+
+WorkerPool::WorkerPool(size_t count) : m_next{0} {
+    for (size_t i = 0; i < count; i++) {
+        m_threads.push_back(std::thread(&WorkerPool::work, this));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_wake.notify_all();
+    for (std::thread &thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t WorkerPool::size() {
+    return m_threads.size() + 1;
+}
+
+void WorkerPool::run(size_t count, std::function<void(size_t)> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = task;
+        m_count = count;
+        m_next = 0;
+        m_busy = m_threads.size();
+        m_generation++;
+    }
+    m_wake.notify_all();
+    drain();
+    // Every thread has to check in, otherwise one that woke up late
+    // could still be reading the task when the next run starts.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busy == 0; });
+    m_task = nullptr;
+}
+
+void WorkerPool::work() {
+    uint64_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_quit || m_generation != generation; });
+            if (m_quit) { return; }
+            generation = m_generation;
+        }
+        drain();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busy == 0) { m_done.notify_one(); }
+    }
+}
+
+void WorkerPool::drain() {
+    size_t i;
+    while ((i = m_next.fetch_add(1)) < m_count) {
+        m_task(i);
+    }
+}
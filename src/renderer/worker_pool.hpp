@@ -0,0 +1,43 @@
+#ifndef WORKER_POOL_HPP
+    #define WORKER_POOL_HPP
+
+    #include <atomic>
+    #include <cstdint>
+    #include <thread>
+    #include <vector>
+    #include <mutex>
+    #include <functional>
+    #include <condition_variable>
+
+    /// A fixed set of threads that split the indices of a task between them.
+    /// The thread calling run() works on the task as well and run() only
+    /// returns once every index has been handled, which makes the pool
+    /// usable from within a frame without any further synchronization.
+    struct WorkerPool {
+        /// Starts `count` threads next to the calling one.
+        WorkerPool(size_t count);
+        ~WorkerPool();
+
+        /// Number of threads working on run(), including the calling one.
+        size_t size();
+
+        /// Calls `task` once for every index below `count`.
+        void run(size_t count, std::function<void(size_t)> task);
+
+        private:
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            std::function<void(size_t)> m_task;
+            size_t m_count = 0;
+            std::atomic<size_t> m_next;
+            /// Threads that have not finished the current run yet.
+            size_t m_busy = 0;
+            uint64_t m_generation = 0;
+            bool m_quit = false;
+
+            void work();
+            void drain();
+    };
+#endif
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <string>
 #include <cassert>
+#include <cstring>
+#include <type_traits>
 
 template <typename T> struct Slice {
 	T *data = nullptr;
@@ -10,5 +13,15 @@ template <typename T> struct Slice {
 		assert(data && "Don't pass around invalid slices!");
 	}
 
+	/// Text slices can be made from strings without copying them,
+	/// the slice is only valid for as long as the string is unchanged.
+	template <typename U = T, typename = typename std::enable_if<std::is_same<U, const char>::value>::type>
+	Slice(const std::string &string) : data{string.data()}, length{string.length()} {}
+
+	template <typename U = T, typename = typename std::enable_if<std::is_same<U, const char>::value>::type>
+	Slice(const char *string) : data{string}, length{strlen(string)} {
+		assert(data && "Don't pass around invalid slices!");
+	}
+
 	~Slice() {}
 };
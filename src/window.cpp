@@ -54,33 +54,64 @@ Window::Window(const char* title, Size size) {
     }
 
     dc = new DrawingContext();
+    m_frame_buffer = new FrameBuffer();
 }
 
 Window::~Window() {
     delete m_main_widget;
     delete m_state;
+    delete m_frame;
+    delete m_previous_frame;
+    delete m_frame_buffer;
     delete dc;
     SDL_GL_DeleteContext(m_sdl_context);
     SDL_DestroyWindow(m_win);
 }
 
 void Window::draw() {
-    dc->renderer->shader.use();
     float projection[16] = {
         2.0f / size.w, 0.0f, 0.0f, 0.0f,
         0.0f, -2.0f / size.h, 0.0f, 0.0f,
         0.0f, 0.0f, -1.0f, 0.0f,
         -1.0f, 1.0f, -0.0f, 1.0f
     };
-    dc->renderer->shader.setMatrix4("u_projection", projection);
-    dc->clear();
-    dc->setClip(Rect(0, 0, size.w, size.h));
-    m_main_widget->draw(*dc, Rect(0, 0, size.w, size.h), m_main_widget->state());
+    dc->renderer->setProjection(projection);
+    dc->renderer->target = size;
+    Rect window_rect = Rect(0, 0, size.w, size.h);
+    dc->setClip(window_rect);
+
+    // The frame gets recorded first so that it can be compared with the
+    // previous one, only the area where they differ is drawn again.
+    std::swap(m_frame, m_previous_frame);
+    dc->beginRecording(m_frame);
+    m_main_widget->drawCached(*dc, window_rect, m_main_widget->state());
     if (m_state->tooltip && draw_tooltip) {
         drawTooltip();
         draw_tooltip = false;
     }
-    dc->render();
+    dc->endRecording();
+
+    int w, h;
+    SDL_GL_GetDrawableSize(m_win, &w, &h);
+    Rect damage = window_rect;
+    if (!m_frame_buffer->resize(Size(w, h))) {
+        damage = m_frame->damage(*m_previous_frame, window_rect, dc->renderer).clipTo(window_rect);
+    }
+    if (damage.w > 0 && damage.h > 0) {
+        m_frame_buffer->bind();
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(damage.x, size.h - (damage.y + damage.h), damage.w, damage.h);
+        dc->clear();
+        glDisable(GL_SCISSOR_TEST);
+        dc->renderer->damage = Option<Rect>(damage);
+        dc->setClip(window_rect);
+        m_frame->replay(dc->renderer);
+        dc->render();
+        dc->renderer->damage = Option<Rect>();
+        dc->renderer->stats.damaged_pixels += damage.w * damage.h;
+    }
+    m_frame_buffer->blit();
+    dc->renderer->endFrame();
 }
 
 Widget* Window::mainWidget() {
@@ -99,8 +130,32 @@ void Window::show() {
     dc->swap_buffer(m_win);
 }
 
+// Sizes cached by the Widgets came from the estimated metrics of the default font.
+static void relayout(Widget *widget) {
+    widget->layout();
+    for (Widget *child : widget->children) {
+        relayout(child);
+    }
+}
+
 void Window::run() {
-    dc->default_font = new Font(DejaVuSans_ttf, DejaVuSans_ttf_length, 14, Font::Type::Sans);
+    // The default font is prebaked and ready right away. When it isn't,
+    // the first frame goes out with the estimated metrics while the
+    // FontLoader rasterizes it, its text shows up once the font is ready.
+    bool was_ready = false;
+    dc->default_font = FontCache::get()->load(DejaVuSans_ttf, DejaVuSans_ttf_length, 14, Font::Type::Sans, [this, &was_ready](Font *font) {
+        if (!was_ready) {
+            relayout(m_main_widget);
+            dc->generation++;
+            // The recorded commands of the previous frame no longer match what's on screen.
+            m_previous_frame->clear();
+            show();
+        }
+        if (onFontReady) {
+            onFontReady(this);
+        }
+    });
+    was_ready = dc->default_font->is_ready;
     setMainWidget(m_main_widget);
     show();
     if (onReady) {
@@ -263,6 +318,7 @@ void Window::run() {
                     quit();
             }
         }
+        FontCache::get()->poll();
         if (delay_till) {
             if (SDL_GetTicks() < delay_till) {
                 goto DELAY;
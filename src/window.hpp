@@ -14,6 +14,7 @@
     #include "keyboard.hpp"
     #include "controls/widget.hpp"
     #include "controls/scrolled_box.hpp"
+    #include "renderer/frame_buffer.hpp"
 
     class Window {
         public:
@@ -33,6 +34,13 @@
             /// but before entering the event loop.
             std::function<void(Window*)> onReady = nullptr;
 
+            /// `onFontReady` gets called from within the event loop once the
+            /// default font has been rasterized and drawn with. The embedded
+            /// font is prebaked, it is ready right away and text measured
+            /// in `onReady` already uses its real metrics. Otherwise text
+            /// measured before this got estimated metrics.
+            std::function<void(Window*)> onFontReady = nullptr;
+
             /// `onQuit` gets called when the Window about to exit but
             /// before anything is freed.
             std::function<bool(Window*)> onQuit = nullptr;
@@ -102,9 +110,17 @@
             SDL_TimerID m_tooltip_callback = -1;
             uint32_t delay_till = 0;
 
-            /// Updates the projection matrix, clears the context and
-            /// renders any state that was stored in the renderer from
-            /// calls to the DrawingContext.
+            /// The primitives of the current and the previous frame,
+            /// their difference is the area that gets redrawn.
+            DrawList *m_frame = new DrawList();
+            DrawList *m_previous_frame = new DrawList();
+            /// Holds the last frame so that only the damaged
+            /// area has to be drawn again, see draw().
+            FrameBuffer *m_frame_buffer = nullptr;
+
+            /// Updates the projection matrix, records the Widget tree and
+            /// renders the parts of it that changed since the previous frame
+            /// into the frame buffer which then gets copied to the window.
             /// Used internally by show().
             void draw();
             void drawTooltip();
@@ -1,4 +1,5 @@
 #include <cassert>
+#include <vector>
 
 #include "../src/application.hpp"
 #include "../src/common/rect.hpp"
@@ -39,6 +40,66 @@ void within() {
     assert(r.clipTo(Rect(0, 540, 2000, 500)) == Rect(2, 850, 150, 24));
 }
 
+// The batched tests have to agree with clipTest() for every rect,
+// whichever side of the clip its edges land on.
+void batchedClipTests() {
+    Rect clip = Rect(40, 40, 20, 20);
+    std::vector<Rect> rects;
+    int edges[] = {0, 39, 40, 41, 50, 59, 60, 61, 100};
+    int sizes[] = {-5, 0, 1, 10, 20, 21, 100};
+    for (int x : edges) {
+        for (int y : edges) {
+            for (int w : sizes) {
+                rects.push_back(Rect(x, y, w, sizes[(x + y + w + 7) % 7]));
+                rects.push_back(Rect(x - w, y - w / 2, w, w));
+            }
+        }
+    }
+    rects.push_back(Rect(45, 45, 5, 5));
+    std::vector<Renderer::ClipTest> tests(rects.size());
+    Renderer::clipTests(rects.data(), rects.size(), clip, tests.data());
+    for (size_t i = 0; i < rects.size(); i++) {
+        assert(tests[i] == Renderer::clipTest(rects[i], clip));
+    }
+    assert(tests.back() == Renderer::ClipTest::Inside);
+}
+
+// A trimmed gradient keeps the colors it had at its new edges.
+void trimmedGradients() {
+    Rect clip = Rect(50, 0, 100, 100);
+    Rect rects[] = {Rect(0, 0, 100, 10), Rect(60, 0, 10, 10), Rect(200, 0, 10, 10), Rect(0, 0, 200, 10), Rect(100, 0, 10, 10)};
+    Renderer::ClipTest tests[5];
+    Renderer::clipTests(rects, 5, clip, tests);
+    assert(tests[0] == Renderer::ClipTest::Partial);
+    assert(tests[1] == Renderer::ClipTest::Inside);
+    assert(tests[2] == Renderer::ClipTest::Outside);
+    assert(tests[3] == Renderer::ClipTest::Partial);
+
+    Rect rect = rects[0];
+    Color from = Color(0.0f, 0.0f, 0.0f);
+    Color to = Color(1.0f, 1.0f, 1.0f);
+    Renderer::trimRect(rect, from, to, Gradient::LeftToRight, clip);
+    assert(rect == Rect(50, 0, 50, 10));
+    assert(from.r == 0.5f && from.g == 0.5f && from.b == 0.5f);
+    assert(to.r == 1.0f);
+
+    rect = rects[3];
+    from = Color(0.0f, 0.0f, 0.0f);
+    to = Color(1.0f, 0.0f, 0.0f);
+    Renderer::trimRect(rect, from, to, Gradient::LeftToRight, clip);
+    assert(rect == Rect(50, 0, 100, 10));
+    assert(from.r == 0.25f && to.r == 0.75f);
+
+    // Vertical gradients are only cut where they cross the clip vertically.
+    rect = Rect(60, 80, 10, 40);
+    from = Color(0.0f, 0.0f, 0.0f);
+    to = Color(1.0f, 0.0f, 0.0f);
+    assert(Renderer::clipTest(rect, clip) == Renderer::ClipTest::Partial);
+    Renderer::trimRect(rect, from, to, Gradient::TopToBottom, clip);
+    assert(rect == Rect(60, 80, 10, 20));
+    assert(from.r == 0.0f && to.r == 0.5f);
+}
+
 int main(int argc, char **argv) {
     lesser_x_or_y();
     greater_x_or_y();
@@ -47,6 +108,8 @@ int main(int argc, char **argv) {
     lesser_no_overlap();
     greater_no_overlap();
     within();
+    batchedClipTests();
+    trimmedGradients();
 
     return 0;
 }
\ No newline at end of file
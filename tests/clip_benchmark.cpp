@@ -0,0 +1,73 @@
+#include <SDL.h>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+#include "../src/controls/box.hpp"
+#include "../src/controls/button.hpp"
+#include "../src/controls/label.hpp"
+#include "../src/controls/scrolled_box.hpp"
+
+// Compares discard based and scissor based clipping on nested
+// ScrolledBoxes, the same kind of layout as scrolled_box_inception_clipping.
+// Every frame is finished with glFinish() so that the GPU time is included.
+#define FRAMES 200
+
+static void benchmark(Window *window, Renderer::ClipMode clip_mode, std::string name) {
+    Renderer *renderer = window->dc->renderer;
+    renderer->setClipMode(clip_mode);
+    window->draw();
+    glFinish();
+    Renderer::Stats before = renderer->stats;
+    uint64_t start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < FRAMES; i++) {
+        window->draw();
+        glFinish();
+    }
+    double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    println(
+        name + ": " + std::to_string(ms / FRAMES) + " ms per frame, " +
+        std::to_string((renderer->stats.draw_calls - before.draw_calls) / FRAMES) + " draw calls per frame, " +
+        std::to_string(renderer->frame_stats.culled) + " culled and " +
+        std::to_string(renderer->frame_stats.trimmed) + " trimmed per frame"
+    );
+}
+
+static ScrolledBox* scrolledBox(Align align, Color color, int depth) {
+    ScrolledBox *box = new ScrolledBox(align, Size(200, 200));
+    box->style.window_background = color;
+    for (int i = 0; i < 25; i++) {
+        box->append(new Label(std::to_string(i)));
+    }
+    if (depth) {
+        box->append(scrolledBox(align == Align::Vertical ? Align::Horizontal : Align::Vertical, Color(color.b, color.r, color.g), depth - 1), Fill::Both);
+    }
+    for (int i = 0; i < 25; i++) {
+        box->append(new Button(std::to_string(i)));
+    }
+    return box;
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            benchmark(window, Renderer::ClipMode::Discard, "Discard");
+            benchmark(window, Renderer::ClipMode::Scissor, "Scissor");
+            window->dc->renderer->setClipMode(Renderer::ClipMode::Discard);
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Clip Benchmark");
+        app->resize(1000, 600);
+        Box *h_box = new Box(Align::Horizontal);
+        {
+            h_box->append(scrolledBox(Align::Vertical, Color("#ff5555"), 3), Fill::Both);
+            h_box->append(scrolledBox(Align::Horizontal, Color("#5555ff"), 3), Fill::Both);
+        }
+        app->append(h_box, Fill::Both);
+    app->run();
+
+    return 0;
+}
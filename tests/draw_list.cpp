@@ -0,0 +1,134 @@
+#include <cassert>
+#include <cstring>
+
+#include "../src/renderer/draw_list.hpp"
+#include "../src/util.hpp"
+
+void recordsCommands() {
+    DrawList list;
+    assert(list.empty());
+    list.setClip(Rect(0, 0, 100, 100));
+    list.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    list.fillRectWithGradient(Rect(0, 0, 50, 50), COLOR_BLACK, COLOR_WHITE, Gradient::LeftToRight);
+    const char *text = "Hello";
+    list.fillText(nullptr, Slice<const char>(text, strlen(text)), Point(5, 5), COLOR_BLACK, 4, false, 5, Renderer::Selection(), COLOR_BLACK);
+    assert(list.count() == 4);
+    assert(list.clip == Rect(0, 0, 100, 100));
+
+    const DrawList::Command *command = list.first();
+    assert(command->type == DrawList::Type::SetClip);
+    command = list.next(command);
+    assert(command->type == DrawList::Type::FillRect);
+    assert(((const DrawList::FillRectCommand*)command)->rect == Rect(10, 10, 20, 20));
+    command = list.next(command);
+    assert(command->type == DrawList::Type::FillRectWithGradient);
+    command = list.next(command);
+    assert(command->type == DrawList::Type::FillText);
+    Slice<const char> recorded = ((const DrawList::FillTextCommand*)command)->text();
+    assert(recorded.length == 5 && !memcmp(recorded.data, "Hello", 5));
+    assert(!list.next(command));
+}
+
+void translatesCommands() {
+    DrawList list;
+    list.setClip(Rect(0, 0, 100, 100));
+    list.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    list.translate(Point(5, -5));
+    const DrawList::Command *command = list.first();
+    assert(((const DrawList::SetClipCommand*)command)->rect == Rect(5, -5, 100, 100));
+    command = list.next(command);
+    assert(((const DrawList::FillRectCommand*)command)->rect == Rect(15, 5, 20, 20));
+    assert(list.clip == Rect(5, -5, 100, 100));
+}
+
+void comparesLists() {
+    DrawList previous;
+    DrawList current;
+    assert(previous == current);
+    previous.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    current.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    assert(previous == current);
+    current.clear();
+    current.fillRect(Rect(10, 10, 20, 21), COLOR_BLACK);
+    assert(previous != current);
+}
+
+void damagesDifferences() {
+    Rect window = Rect(0, 0, 100, 100);
+    DrawList previous;
+    DrawList current;
+    previous.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    previous.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    previous.fillRect(Rect(50, 50, 10, 10), COLOR_BLACK);
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    current.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    current.fillRect(Rect(50, 50, 10, 10), COLOR_BLACK);
+    assert(current.damage(previous, window, nullptr) == Rect());
+
+    // A primitive that moved damages both its old and new bounds.
+    current.clear();
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    current.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    current.fillRect(Rect(60, 60, 10, 10), COLOR_BLACK);
+    assert(current.damage(previous, window, nullptr) == Rect(50, 50, 20, 20));
+
+    // An identical primitive under a different clip is damaged too.
+    previous.clear();
+    previous.setClip(Rect(0, 0, 50, 50));
+    previous.fillRect(Rect(0, 0, 100, 100), COLOR_BLACK);
+    current.clear();
+    current.setClip(Rect(0, 0, 40, 40));
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_BLACK);
+    assert(current.damage(previous, window, nullptr) == Rect(0, 0, 50, 50));
+
+    // Commands that only exist in one of the lists.
+    current.clear();
+    current.setClip(Rect(0, 0, 50, 50));
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_BLACK);
+    current.fillRect(Rect(5, 5, 5, 5), COLOR_WHITE);
+    assert(current.damage(previous, window, nullptr) == Rect(5, 5, 5, 5));
+
+    // A command inserted in the middle, like the caret of a focused
+    // LineEdit, only damages itself and not everything drawn after it.
+    previous.clear();
+    previous.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    for (int i = 0; i < 10; i++) {
+        previous.setClip(Rect(0, i * 10, 100, 10));
+        previous.fillRect(Rect(0, i * 10, 100, 10), COLOR_WHITE);
+        previous.fillRect(Rect(5, i * 10 + 2, 50, 6), COLOR_BLACK);
+    }
+    current.clear();
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    for (int i = 0; i < 10; i++) {
+        current.setClip(Rect(0, i * 10, 100, 10));
+        current.fillRect(Rect(0, i * 10, 100, 10), COLOR_WHITE);
+        if (i == 3) {
+            current.fillRect(Rect(60, 32, 1, 6), COLOR_BLACK);
+        }
+        current.fillRect(Rect(5, i * 10 + 2, 50, 6), COLOR_BLACK);
+    }
+    assert(current.damage(previous, window, nullptr) == Rect(60, 32, 1, 6));
+    // And removing it again the same.
+    assert(previous.damage(current, window, nullptr) == Rect(60, 32, 1, 6));
+
+    // Replacing a command with two others damages all three.
+    previous.clear();
+    previous.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    previous.fillRect(Rect(10, 10, 10, 10), COLOR_BLACK);
+    previous.fillRect(Rect(80, 80, 10, 10), COLOR_BLACK);
+    current.clear();
+    current.fillRect(Rect(0, 0, 100, 100), COLOR_WHITE);
+    current.fillRect(Rect(20, 20, 10, 10), COLOR_BLACK);
+    current.fillRect(Rect(30, 30, 10, 10), COLOR_BLACK);
+    current.fillRect(Rect(80, 80, 10, 10), COLOR_BLACK);
+    assert(current.damage(previous, window, nullptr) == Rect(10, 10, 30, 30));
+}
+
+int main(int argc, char **argv) {
+    recordsCommands();
+    translatesCommands();
+    comparesLists();
+    damagesDifferences();
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <cassert>
+#include <atomic>
+#include <cstring>
+
+#include "../src/renderer/quad_list.hpp"
+#include "../src/renderer/worker_pool.hpp"
+#include "../src/util.hpp"
+
+static const Rect window = Rect(0, 0, 100, 100);
+
+void cullsAndTrims() {
+    DrawList list;
+    list.fillRect(Rect(10, 10, 20, 20), COLOR_BLACK);
+    list.fillRect(Rect(200, 200, 20, 20), COLOR_BLACK);
+    list.fillRect(Rect(90, 90, 20, 20), COLOR_BLACK);
+    QuadList quads;
+    quads.build(list, list.first(), nullptr, window, Option<Rect>(), false);
+    assert(quads.quads.size() == 2);
+    assert(quads.culled == 1);
+    assert(quads.trimmed == 1);
+    const Renderer::Instance &trimmed = quads.quads[1].instance;
+    assert(trimmed.rect[0] == 90 && trimmed.rect[1] == 90 && trimmed.rect[2] == 100 && trimmed.rect[3] == 100);
+    assert(!quads.quads[1].is_clipped);
+}
+
+void followsClips() {
+    DrawList list;
+    list.fillRect(Rect(0, 0, 10, 10), COLOR_BLACK);
+    list.setClip(Rect(0, 0, 50, 50));
+    list.fillRect(Rect(40, 40, 20, 20), COLOR_BLACK);
+    QuadList quads;
+    // The damaged area cuts down every clip, including the first one.
+    quads.build(list, list.first(), nullptr, window, Option<Rect>(Rect(0, 0, 45, 45)), false, Point(-5, -5));
+    assert(quads.clips.size() == 2);
+    assert(quads.clips[0] == Rect(0, 0, 45, 45));
+    assert(quads.clips[1] == Rect(0, 0, 45, 45));
+    assert(quads.quads.size() == 2);
+    assert(quads.quads[0].clip == 0);
+    assert(quads.quads[1].clip == 1);
+    const Renderer::Instance &moved = quads.quads[0].instance;
+    assert(moved.rect[0] == 0 && moved.rect[1] == 0 && moved.rect[2] == 5 && moved.rect[3] == 5);
+}
+
+void splitsInPaintOrder() {
+    DrawList list;
+    for (int i = 0; i < 64; i++) {
+        if (i % 16 == 0) { list.setClip(Rect(i, 0, 50, 100)); }
+        list.fillRect(Rect(i, i, 10, 10), Color(i / 64.0f, 0.0f, 0.0f));
+    }
+    QuadList whole;
+    whole.build(list, list.first(), nullptr, window, Option<Rect>(), false);
+
+    // Builds the list in four ranges the way DrawList::replay() does.
+    const DrawList::Command *begins[5];
+    Rect clips[4];
+    Rect clip = window;
+    size_t i = 0;
+    for (const DrawList::Command *command = list.first(); command; command = list.next(command), i++) {
+        if (i % 20 == 0) {
+            begins[i / 20] = command;
+            clips[i / 20] = clip;
+        }
+        if (command->type == DrawList::Type::SetClip) {
+            clip = ((const DrawList::SetClipCommand*)command)->rect;
+        }
+    }
+    begins[4] = nullptr;
+    QuadList ranges[4];
+    WorkerPool workers(3);
+    workers.run(4, [&](size_t range) {
+        ranges[range].build(list, begins[range], begins[range + 1], clips[range], Option<Rect>(), false);
+    });
+
+    size_t quad = 0;
+    uint64_t culled = 0;
+    for (QuadList &range : ranges) {
+        for (const QuadList::Quad &q : range.quads) {
+            assert(!memcmp(&q.instance, &whole.quads[quad].instance, sizeof(Renderer::Instance)));
+            assert(range.clips[q.clip] == whole.clips[whole.quads[quad].clip]);
+            quad++;
+        }
+        culled += range.culled;
+    }
+    assert(quad == whole.quads.size());
+    assert(culled == whole.culled);
+}
+
+void runsEveryTask() {
+    WorkerPool workers(4);
+    assert(workers.size() == 5);
+    for (int run = 0; run < 100; run++) {
+        std::atomic<size_t> sum{0};
+        workers.run(1000, [&](size_t i) { sum += i; });
+        assert(sum == 999 * 1000 / 2);
+    }
+    WorkerPool single(0);
+    size_t count = 0;
+    single.run(10, [&](size_t i) { count++; });
+    assert(count == 10);
+}
+
+int main(int argc, char **argv) {
+    cullsAndTrims();
+    followsClips();
+    splitsInPaintOrder();
+    runsEveryTask();
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <SDL.h>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+#include "../src/renderer/program_cache.hpp"
+
+// Reports how long it takes to get the application window up and how much
+// of that went to shaders and fonts. Running it twice shows the difference
+// between compiling from source and loading from the program binary cache.
+int main(int argc, char **argv) {
+    uint64_t start = SDL_GetPerformanceCounter();
+    Application *app = Application::get();
+    double startup_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+        app->onReady = [&](Window *window) {
+            ProgramCache::Stats stats = ProgramCache::stats;
+            println("Startup: " + std::to_string(startup_ms) + " ms");
+            println("Program cache supported: " + std::string(ProgramCache::supported() ? "yes" : "no"));
+            println("Program cache hits: " + std::to_string(stats.hits) + ", misses: " + std::to_string(stats.misses));
+            println("Shaders loaded in: " + std::to_string(stats.load_ms) + " ms");
+            println("Shaders compiled in: " + std::to_string(stats.compile_ms) + " ms");
+            for (Font *font : FontCache::get()->fonts()) {
+                println(
+                    font->file_path + " " + std::to_string(font->pixel_size) + "px loaded in: " + std::to_string(font->stats.load_ms) + " ms, " +
+                    std::to_string(font->stats.background_ms) + " ms in the background, " +
+                    std::to_string(font->stats.rasterized) + " glyphs, " + std::to_string(font->stats.bitmap_bytes) + " bytes of bitmaps"
+                );
+            }
+            GlyphAtlas *atlas = FontCache::get()->atlas();
+            println(
+                "Glyph atlas: " + std::to_string(atlas->pages.size()) + " pages of " + std::to_string(atlas->page_size) + "px, " +
+                std::to_string(atlas->stats.page_bytes) + " bytes"
+            );
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Startup Test");
+        app->resize(400, 400);
+    app->run();
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <new>
+#include <cassert>
+#include <cstdlib>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+#include "../src/controls/label.hpp"
+#include "../src/controls/button.hpp"
+#include "../src/controls/line_edit.hpp"
+#include "../src/controls/check_button.hpp"
+#include "../src/controls/progress_bar.hpp"
+
+// Drawing and measuring text shouldn't touch the heap once the
+// glyph layouts are cached and the buffers have grown to size.
+// Every operator new in the process goes through the counter below.
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void *pointer = malloc(size ? size : 1);
+    if (!pointer) { throw std::bad_alloc(); }
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    free(pointer);
+}
+
+// The texts are longer than what std::string keeps inline so that any copy allocates.
+static const std::string text = "Strings longer than the small string buffer";
+
+static void frame(DrawingContext &dc, std::vector<Widget*> &widgets) {
+    Rect rect = Rect(0, 0, 300, 30);
+    dc.measureText(nullptr, text);
+    dc.measureText(nullptr, 'W');
+    dc.measureTextMultiline(nullptr, "Two lines\nof text that are long enough");
+    dc.fillText(nullptr, text, Point(0, 0));
+    dc.fillTextMultiline(nullptr, "Two lines\nof text that are long enough", Point(0, 0));
+    dc.fillTextAligned(nullptr, text, HorizontalAlignment::Center, VerticalAlignment::Center, rect, 5);
+    dc.fillTextMultilineAligned(nullptr, "Two lines\nof text that are long enough", HorizontalAlignment::Right, VerticalAlignment::Bottom, rect, 5);
+    for (Widget *widget : widgets) {
+        widget->sizeHint(dc);
+        widget->draw(dc, rect, Drawable::STATE_DEFAULT);
+    }
+}
+
+static size_t count(DrawingContext &dc, std::vector<Widget*> &widgets, DrawList *list) {
+    // Warm up the TextRunCache, the DrawList arena and the widgets' sizeHint().
+    for (int i = 0; i < 2; i++) {
+        if (list) { dc.beginRecording(list); }
+        frame(dc, widgets);
+        if (list) { dc.endRecording(); }
+        dc.render();
+    }
+    size_t before = allocations;
+    if (list) { dc.beginRecording(list); }
+    frame(dc, widgets);
+    if (list) { dc.endRecording(); }
+    size_t after = allocations;
+    dc.render();
+    return after - before;
+}
+
+// Goes through Window::draw() which records the Widgets, diffs the frame
+// against the previous one and measures the text of the damaged commands.
+static size_t countWindow(Window *window, Label *label) {
+    const std::string texts[2] = {"A label whose text changes every frame", "A label whose text changed again since"};
+    for (int i = 0; i < 4; i++) {
+        label->setText(texts[i % 2]);
+        window->show();
+    }
+    label->setText(texts[0]);
+    size_t before = allocations;
+    window->show();
+    return allocations - before;
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            DrawingContext &dc = *window->dc;
+            ProgressBar *progress_bar = new ProgressBar();
+            progress_bar->setValue(0.42);
+            std::vector<Widget*> widgets = {
+                new Label("A label that\nspans a couple of lines"),
+                new Button("A button with a long caption"),
+                new LineEdit("A line edit with some text in it"),
+                new LineEdit("", "A placeholder that is long as well"),
+                new CheckButton("A check button with a long caption"),
+                progress_bar
+            };
+            dc.setClip(Rect(0, 0, window->size.w, window->size.h));
+            size_t direct = count(dc, widgets, nullptr);
+            DrawList list;
+            size_t recorded = count(dc, widgets, &list);
+            Label *label = new Label("");
+            widgets.push_back(label);
+            for (Widget *widget : widgets) {
+                window->append(widget);
+            }
+            size_t damaged = countWindow(window, label);
+            println(
+                "Allocations while drawing text: " + std::to_string(direct) +
+                ", while recording: " + std::to_string(recorded) +
+                ", while redrawing the damage: " + std::to_string(damaged)
+            );
+            assert(direct == 0);
+            assert(recorded == 0);
+            assert(damaged == 0);
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Text Allocations");
+    app->run();
+
+    return 0;
+}
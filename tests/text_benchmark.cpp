@@ -0,0 +1,102 @@
+#include <vector>
+#include <cassert>
+#include <cstring>
+
+#include <SDL.h>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+
+// Compares the scalar and the SSE2 path of Renderer::fillText() on a
+// 100k character paragraph, with and without the TextRunCache.
+// Only the CPU side of laying out the glyphs is timed, the batches
+// get submitted outside of the measured loop.
+#define PARAGRAPH_LENGTH 100000
+#define LINE_LENGTH 100
+#define RUNS 20
+
+static std::string paragraph() {
+    const char *words[] = { "lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "Sed\tdo", "eiusmod" };
+    std::string text;
+    for (size_t i = 0; text.length() < PARAGRAPH_LENGTH; i++) {
+        text += words[i % 10];
+        text += " ";
+    }
+    return text.substr(0, PARAGRAPH_LENGTH);
+}
+
+// Both paths have to produce exactly the same vertices, including
+// glyphs that are partially clipped or lie outside of the window.
+static void compare(Renderer *renderer, Font *font, std::string text) {
+    std::vector<unsigned char> scalar;
+    for (bool vectorized : { false, true }) {
+        renderer->render();
+        renderer->vectorized_text = vectorized;
+        renderer->setClip(Rect(37, 0, 500, 12));
+        renderer->fillText(font, Slice<const char>(text.c_str(), text.length()), Point(-53, 5), COLOR_BLACK, 4, false, 5, Renderer::Selection(30, 12), COLOR_WHITE);
+        const unsigned char *data = (const unsigned char*)renderer->vertices;
+        size_t size = sizeof(Renderer::Vertex) * renderer->index;
+        if (renderer->mode == Renderer::Mode::Instanced) {
+            data = (const unsigned char*)renderer->instances;
+            size = sizeof(Renderer::Instance) * renderer->quad_count;
+        }
+        if (!vectorized) {
+            scalar.assign(data, data + size);
+        } else {
+            assert(size == scalar.size());
+            assert(!memcmp(data, scalar.data(), size));
+        }
+    }
+    renderer->render();
+}
+
+static void benchmark(Window *window, bool vectorized, bool cached, std::string name) {
+    Renderer *renderer = window->dc->renderer;
+    Font *font = window->dc->default_font;
+    std::string text = paragraph();
+    Size size = window->size;
+    renderer->vectorized_text = vectorized;
+    renderer->text_runs = cached ? window->dc->text_runs : nullptr;
+    renderer->setClip(Rect(0, 0, size.w, size.h));
+    double ms = 0.0;
+    for (int run = 0; run < RUNS; run++) {
+        uint64_t start = SDL_GetPerformanceCounter();
+        for (size_t i = 0; i < text.length(); i += LINE_LENGTH) {
+            int line = i / LINE_LENGTH;
+            int y = (line * font->max_height) % size.h;
+            renderer->fillText(font, Slice<const char>(text.c_str() + i, LINE_LENGTH), Point(0, y));
+        }
+        ms += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+        renderer->render();
+    }
+    renderer->text_runs = window->dc->text_runs;
+    println(
+        name + ": " + std::to_string(ms / RUNS) + " ms per paragraph, " +
+        std::to_string((uint64_t)(PARAGRAPH_LENGTH * RUNS / (ms / 1000.0))) + " glyphs per second"
+    );
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            std::string line = paragraph().substr(0, 200);
+            compare(window->dc->renderer, window->dc->default_font, line);
+            window->dc->renderer->setMode(Renderer::Mode::Instanced);
+            compare(window->dc->renderer, window->dc->default_font, line);
+            window->dc->renderer->setMode(Renderer::Mode::Vertices);
+            benchmark(window, false, false, "Scalar");
+            benchmark(window, true, false, "SSE2");
+            benchmark(window, false, true, "Scalar, cached");
+            benchmark(window, true, true, "SSE2, cached");
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Text Benchmark");
+        app->resize(1000, 600);
+    app->run();
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <cassert>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+
+// Draws the same line at growing sizes, rasterized on the left
+// and scaled from the distance field of the face on the right.
+class Sizes : public Widget {
+    public:
+        const char* name() {
+            return "Sizes";
+        }
+
+        Font* font(unsigned int pixel_size, Font::Rendering rendering) {
+            return FontCache::get()->font(DejaVuSans_ttf, DejaVuSans_ttf_length, pixel_size, Font::Type::Sans, rendering);
+        }
+
+        void draw(DrawingContext &dc, Rect rect, int state) {
+            this->rect = rect;
+            dc.fillRect(rect, COLOR_WHITE);
+            int y = rect.y;
+            for (unsigned int size = 8; size <= 64; size += 8) {
+                Font *bitmap = font(size, Font::Rendering::Bitmap);
+                Font *field = font(size, Font::Rendering::DistanceField);
+                dc.fillText(bitmap, "Sphinx of black quartz", Point(rect.x, y));
+                dc.fillText(field, "Sphinx of black quartz", Point(rect.x + rect.w / 2, y));
+                y += field->max_height + 4;
+            }
+        }
+
+        Size sizeHint(DrawingContext &dc) {
+            return Size(1400, 400);
+        }
+};
+
+void scalesOneFieldPerFace() {
+    FontCache *cache = FontCache::get();
+    size_t loaded = cache->fonts().size();
+    Font *small = cache->font(DejaVuSans_ttf, DejaVuSans_ttf_length, 12, Font::Type::Sans, Font::Rendering::DistanceField);
+    // The source of the face comes along with the first size.
+    assert(cache->fonts().size() == loaded + 2);
+    Font *big = cache->font(DejaVuSans_ttf, DejaVuSans_ttf_length, 36, Font::Type::Sans, Font::Rendering::DistanceField);
+    assert(cache->fonts().size() == loaded + 3);
+    assert(small->rendering == Font::Rendering::DistanceField);
+    assert(!small->stats.rasterized && !big->stats.rasterized);
+    // Every size samples the same glyphs.
+    assert(small->metrics.texture['A'] == big->metrics.texture['A']);
+    assert(small->metrics.uv_top_left['A'] == big->metrics.uv_top_left['A']);
+    assert(big->metrics.advance['A'] > small->metrics.advance['A'] * 2);
+    assert(big->glyph(0xE9).width > small->glyph(0xE9).width);
+    assert(!small->stats.rasterized && !big->stats.rasterized);
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            scalesOneFieldPerFace();
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Text Distance Field");
+        app->append(new Sizes());
+    app->run();
+
+    return 0;
+}
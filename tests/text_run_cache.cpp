@@ -0,0 +1,118 @@
+#include <new>
+#include <cassert>
+#include <cstring>
+
+#include "../src/util.hpp"
+#include "../src/application.hpp"
+
+static Slice<const char> slice(const char *text) {
+    return Slice<const char>(text, strlen(text));
+}
+
+void hitsUnchangedText(Font *font) {
+    TextRunCache cache;
+    Size size = cache.get(font, slice("Hello world"), 4, false, 5).size;
+    assert(cache.stats.misses == 1 && cache.stats.hits == 0);
+    assert(cache.get(font, slice("Hello world"), 4, false, 5).size == size);
+    assert(cache.stats.misses == 1 && cache.stats.hits == 1);
+    // Line spacing only matters for multiline text.
+    cache.get(font, slice("Hello world"), 4, false, 10);
+    assert(cache.stats.hits == 2);
+
+    cache.get(font, slice("Hello world!"), 4, false, 5);
+    cache.get(font, slice("Hello\tworld"), 4, false, 5);
+    cache.get(font, slice("Hello\tworld"), 8, false, 5);
+    cache.get(font, slice("Hello\nworld"), 4, true, 5);
+    cache.get(font, slice("Hello\nworld"), 4, false, 5);
+    assert(cache.stats.misses == 6);
+}
+
+void matchesLayout(Font *font) {
+    TextRunCache cache;
+    TextRun run;
+    run.layout(font, slice("Lorem ipsum\tdolor"), 4, false, 5);
+    const TextRun &cached = cache.get(font, slice("Lorem ipsum\tdolor"), 4, false, 5);
+    assert(cached.size == run.size);
+    assert(cached.count() == run.count());
+    assert(cached.x == run.x && cached.y == run.y && cached.index == run.index);
+    // Whitespace has no quad.
+    assert(run.count() == strlen("Loremipsumdolor"));
+}
+
+void laysOutUtf8(Font *font) {
+    TextRunCache cache;
+    const TextRun &run = cache.get(font, slice("Gr\xc3\xbc\xc3\x9f" "e"), 4, false, 5);
+    assert(run.count() == 5);
+    // Indices are byte offsets of each character.
+    assert(run.index[2] == 2 && run.index[3] == 4 && run.index[4] == 6);
+    assert(run.size.w == cache.get(font, slice("Gr\xc3\xbc\xc3\x9f" "e"), 4, false, 5).size.w);
+    assert(cache.stats.hits == 1);
+
+    // Runs laid out before the font evicted glyphs get laid out again.
+    font->atlas->generation++;
+    cache.get(font, slice("Gr\xc3\xbc\xc3\x9f" "e"), 4, false, 5);
+    assert(cache.stats.hits == 1 && cache.stats.misses == 2);
+
+    size_t i = 0;
+    assert(Font::decode(slice("\xe2\x82\xac"), i) == 0x20AC && i == 3);
+    i = 0;
+    assert(Font::decode(slice("\xc0\xaf"), i) == 0xFFFD && i == 1);
+}
+
+void evictsLeastRecentlyUsed(Font *font) {
+    TextRunCache cache(1);
+    cache.get(font, slice("first"), 4, false, 5);
+    cache.get(font, slice("second"), 4, false, 5);
+    assert(cache.stats.evictions == 1);
+    cache.get(font, slice("second"), 4, false, 5);
+    assert(cache.stats.hits == 1);
+    cache.get(font, slice("first"), 4, false, 5);
+    assert(cache.stats.misses == 3);
+
+    TextRunCache budgeted(cache.bytes() * 2 + 1);
+    budgeted.get(font, slice("first"), 4, false, 5);
+    budgeted.get(font, slice("other"), 4, false, 5);
+    budgeted.get(font, slice("first"), 4, false, 5);
+    budgeted.get(font, slice("third"), 4, false, 5);
+    assert(budgeted.stats.evictions == 1);
+    // "other" was the least recently used one.
+    budgeted.get(font, slice("first"), 4, false, 5);
+    assert(budgeted.stats.hits == 2);
+    assert(budgeted.bytes() <= budgeted.budget);
+    budgeted.clear();
+    assert(!budgeted.bytes());
+}
+
+// A Font created where a deleted one used to be doesn't get its runs.
+void tellsReusedAddressesApart() {
+    TextRunCache cache;
+    Font *font = new Font(DejaVuSans_ttf, DejaVuSans_ttf_length, 14, Font::Type::Sans);
+    Size small = cache.get(font, slice("Hello world"), 4, false, 5).size;
+    font->~Font();
+    new (font) Font(DejaVuSans_ttf, DejaVuSans_ttf_length, 28, Font::Type::Sans);
+    Size large = cache.get(font, slice("Hello world"), 4, false, 5).size;
+    assert(cache.stats.misses == 2 && cache.stats.hits == 0);
+    assert(large.w > small.w);
+    delete font;
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            Font *font = window->dc->default_font;
+            hitsUnchangedText(font);
+            matchesLayout(font);
+            laysOutUtf8(font);
+            evictsLeastRecentlyUsed(font);
+            tellsReusedAddressesApart();
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Text Run Cache");
+    app->run();
+
+    return 0;
+}
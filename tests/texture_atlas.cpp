@@ -0,0 +1,47 @@
+#include <cassert>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/util.hpp"
+#include "../src/resources.hpp"
+#include "../src/application.hpp"
+#include "../src/renderer/atlas.hpp"
+
+// Two different images decoded from the same buffer must not share a Texture.
+void reusedBuffer(TextureAtlas &atlas) {
+    std::vector<unsigned char> buffer(std::max(close_png_length, up_arrow_png_length));
+    memcpy(buffer.data(), close_png, close_png_length);
+    std::shared_ptr<Texture> close = atlas.add(buffer.data(), close_png_length);
+    memcpy(buffer.data(), up_arrow_png, up_arrow_png_length);
+    std::shared_ptr<Texture> up_arrow = atlas.add(buffer.data(), up_arrow_png_length);
+    assert(close != up_arrow);
+    assert(close->u0 != up_arrow->u0 || close->v0 != up_arrow->v0);
+}
+
+// The same image from anywhere else gets the Texture that is already there.
+void sharedContents(TextureAtlas &atlas) {
+    std::shared_ptr<Texture> embedded = atlas.add(close_thin_png, close_thin_png_length);
+    std::vector<unsigned char> copy(close_thin_png, close_thin_png + close_thin_png_length);
+    assert(atlas.add(copy.data(), close_thin_png_length) == embedded);
+    assert(atlas.add(close_png, close_png_length) != embedded);
+}
+
+int main(int argc, char **argv) {
+    Application *app = Application::get();
+        app->onReady = [&](Window *window) {
+            TextureAtlas atlas;
+            reusedBuffer(atlas);
+            sharedContents(atlas);
+            println("OK");
+            if (argc > 1) {
+                if (std::string(argv[1]) == std::string("quit")) {
+                    window->quit();
+                }
+            }
+        };
+        app->setTitle("Texture Atlas");
+    app->run();
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <string>
+
+#include "../src/resources.hpp"
+#include "../src/renderer/font.hpp"
+#include "../src/renderer/glyph_atlas.hpp"
+
+// Writes src/renderer/prebaked_fonts.cpp, run from the root of the repository
+// through `make fonts`. The glyphs come from Font::rasterizeSheet() so they
+// are exactly what the FontLoader would have rasterized at runtime.
+
+struct Baked {
+    const char *name;
+    const unsigned char *data;
+    unsigned int length;
+    unsigned int pixel_size;
+};
+
+// The embedded default font at the size Window::run() loads it with.
+static const Baked BAKED[] = {
+    {"DejaVuSans_ttf", DejaVuSans_ttf, DejaVuSans_ttf_length, 14},
+};
+
+static std::string bakeFont(FT_Library library, const Baked &baked) {
+    FT_Face face;
+    if (FT_New_Memory_Face(library, baked.data, baked.length, 0, &face) || FT_Set_Pixel_Sizes(face, 0, baked.pixel_size)) {
+        fprintf(stderr, "Failed to load %s\n", baked.name);
+        return "";
+    }
+    Font::Sheet sheet;
+    Font::rasterizeSheet(face, GLYPH_ATLAS_PAGE_SIZE - 1, sheet);
+    FT_Done_Face(face);
+    if (!sheet.is_loaded) {
+        fprintf(stderr, "Failed to rasterize %s\n", baked.name);
+        return "";
+    }
+    std::string tab = "    ";
+    std::string name = std::string(baked.name) + "_" + std::to_string(baked.pixel_size);
+    std::string pixels = name + "_pixels";
+    std::string string = "static const unsigned char " + pixels + "[] = {\n" + tab;
+    char hex[8];
+    for (size_t i = 0; i < sheet.pixels.size(); i++) {
+        snprintf(hex, sizeof(hex), "0x%02X, ", sheet.pixels[i]);
+        string += hex;
+        if ((i + 1) % 12 == 0) {
+            string += "\n" + tab;
+        }
+    }
+    string += "\n};\n\n";
+    string += "static constexpr PrebakedFont " + name + " = {\n";
+    string += tab + baked.name + ", " + std::to_string(baked.length) + ", " + std::to_string(baked.pixel_size) + ", ";
+    string += std::to_string(sheet.cap_height) + ", " + std::to_string(sheet.width) + ", " + std::to_string(sheet.height) + ", ";
+    string += pixels + ", {\n";
+    for (uint32_t c = 32; c < 128; c++) {
+        const Font::Glyph &glyph = sheet.glyphs[c];
+        string += tab + tab + "{" +
+            std::to_string(glyph.advance) + ", " + std::to_string(glyph.offset_x) + ", " + std::to_string(glyph.offset_y) + ", " +
+            std::to_string(glyph.width) + ", " + std::to_string(glyph.height) + ", " +
+            std::to_string(sheet.x[c]) + ", " + std::to_string(sheet.y[c]) + "},\n";
+    }
+    string += tab + "}\n};\n\n";
+    return string;
+}
+
+int main() {
+    FT_Library library;
+    if (FT_Init_FreeType(&library)) {
+        fprintf(stderr, "Failed to initialise FreeType\n");
+        return 1;
+    }
+    std::string cpp = "// Generated by tools/bake_fonts.cpp, do not edit.\n";
+    cpp += "#include \"prebaked_font.hpp\"\n#include \"../resources.hpp\"\n\n";
+    std::string fonts;
+    for (const Baked &baked : BAKED) {
+        std::string font = bakeFont(library, baked);
+        if (font.empty()) {
+            return 1;
+        }
+        cpp += font;
+        fonts += std::string(fonts.empty() ? "" : ", ") + "&" + baked.name + "_" + std::to_string(baked.pixel_size);
+    }
+    FT_Done_FreeType(library);
+    cpp += "static constexpr const PrebakedFont *FONTS[] = {" + fonts + "};\n\n";
+    cpp +=
+        "const PrebakedFont* PrebakedFont::find(const unsigned char *data, signed long length, unsigned int pixel_size) {\n"
+        "    for (const PrebakedFont *font : FONTS) {\n"
+        "        if (font->data == data && (signed long)font->length == length && font->pixel_size == pixel_size) {\n"
+        "            return font;\n"
+        "        }\n"
+        "    }\n"
+        "    return nullptr;\n"
+        "}\n";
+    FILE *file = fopen("src/renderer/prebaked_fonts.cpp", "w");
+    if (!file) {
+        fprintf(stderr, "Failed to open src/renderer/prebaked_fonts.cpp\n");
+        return 1;
+    }
+    fputs(cpp.c_str(), file);
+    fclose(file);
+    return 0;
+}